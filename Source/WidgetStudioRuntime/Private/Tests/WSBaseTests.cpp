@@ -0,0 +1,108 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+
+#include "Tests/WSTestRenderer.h"
+#include "Misc/AutomationTest.h"
+#include "Debugging/SlateDebugging.h"
+#include "Widgets/Basic/WSIcon.h"
+#include "Widgets/Basic/WSText.h"
+#include "Widgets/Modern/WSModernButton.h"
+#include "Widgets/Modern/WSModernCard.h"
+#include "Widgets/Modern/WSModernCheckBox.h"
+#include "Widgets/Modern/WSModernComboBox.h"
+#include "Widgets/Modern/WSModernSlider.h"
+#include "Widgets/Modern/WSModernSpinBox.h"
+#include "Widgets/Modern/WSModernSwitch.h"
+#include "Widgets/Modern/WSModernTabBar.h"
+#include "Widgets/Modern/WSModernTextField.h"
+#include "Widgets/Utility/WSDivider.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_SLATE_DEBUGGING
+
+/* Returns true if the widget is the ancestor or one of its descendants */
+static bool IsWidgetWithin(const SWidget* Widget, const SWidget* Ancestor)
+{
+	while (Widget)
+	{
+		if (Widget == Ancestor) { return true; }
+		Widget = Widget->GetParentWidget().Get();
+	}
+	return false;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWidgetStudioSettledPaintTest, "WidgetStudio.Widgets.SettledPaint",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWidgetStudioSettledPaintTest::RunTest(const FString& Parameters)
+{
+	if (!FWidgetStudioTestRenderer::CanDraw())
+	{
+		AddWarning(TEXT("Slate is not initialized, the widgets can't be painted"));
+		return true;
+	}
+
+	// The progress bar is left out, its indicator sweeps for as long as it is displayed
+	const TArray<UClass*> WidgetClasses = {
+		UWidgetStudioIcon::StaticClass(),
+		UWidgetStudioText::StaticClass(),
+		UWidgetStudioModernButton::StaticClass(),
+		UWidgetStudioModernCard::StaticClass(),
+		UWidgetStudioModernCheckBox::StaticClass(),
+		UWidgetStudioModernComboBox::StaticClass(),
+		UWidgetStudioModernSlider::StaticClass(),
+		UWidgetStudioModernSpinBox::StaticClass(),
+		UWidgetStudioModernSwitch::StaticClass(),
+		UWidgetStudioModernTabBar::StaticClass(),
+		UWidgetStudioModernTextField::StaticClass(),
+		UWidgetStudioDivider::StaticClass()
+	};
+
+	FWidgetStudioTestRenderer Renderer;
+	for (UClass* WidgetClass : WidgetClasses)
+	{
+		UWidgetStudioBase* Widget = FWidgetStudioTestRenderer::CreateTestWidget(WidgetClass);
+
+		// Containers paint their options, so give them some
+		if (UWidgetStudioContainer* Container = Cast<UWidgetStudioContainer>(Widget))
+		{
+			Container->SetOptions(FWidgetStudioTestRenderer::MakeOptions(3));
+		}
+
+		if (!TestTrue(FString::Printf(TEXT("%s settles"), *WidgetClass->GetName()), Renderer.Settle(Widget)))
+		{
+			continue;
+		}
+
+		// Count the invalidations of the widget and its children over the next frames
+		const SWidget* SlateWidget = Widget->GetCachedWidget().Get();
+		int32 NumInvalidations = 0;
+		const FDelegateHandle InvalidateHandle = FSlateDebugging::WidgetInvalidateEvent.AddLambda(
+			[SlateWidget, &NumInvalidations](const FSlateDebuggingInvalidateArgs& Args)
+			{
+				if (IsWidgetWithin(Args.WidgetInvalidated, SlateWidget))
+				{
+					NumInvalidations++;
+				}
+			});
+
+		for (int32 Frame = 0; Frame < 10; Frame++)
+		{
+			Renderer.DrawFrame(Widget);
+		}
+
+		FSlateDebugging::WidgetInvalidateEvent.Remove(InvalidateHandle);
+
+		TestEqual(FString::Printf(TEXT("Invalidations while painting a settled %s"), *WidgetClass->GetName()), NumInvalidations, 0);
+	}
+
+	return true;
+}
+
+#endif
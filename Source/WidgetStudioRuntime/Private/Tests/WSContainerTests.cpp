@@ -0,0 +1,226 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+
+#include "Tests/WSTestRenderer.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/WSTestWidgets.h"
+#include "Widgets/Modern/WSModernComboBox.h"
+#include "Widgets/Modern/WSModernTabBar.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWidgetStudioContainerDiffTest, "WidgetStudio.Widgets.ContainerDiff",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWidgetStudioContainerDiffTest::RunTest(const FString& Parameters)
+{
+	const TArray<FButtonOptions> Options = FWidgetStudioTestRenderer::MakeOptions(5);
+
+	UWidgetStudioTestContainer* Container = Cast<UWidgetStudioTestContainer>(FWidgetStudioTestRenderer::CreateTestWidget(UWidgetStudioTestContainer::StaticClass()));
+	Container->SetOptions({ Options[0], Options[1], Options[2], Options[3] });
+	Container->SetCurrentIndex(2, false);
+	Container->OnCurrentIndexChanged.AddDynamic(Container, &UWidgetStudioTestContainer::RecordCurrentIndex);
+
+	// Remove the second option, move the last one to the front and change it, insert a new one
+	FButtonOptions UpdatedOption = Options[3];
+	UpdatedOption.Text = FText::FromString(TEXT("Updated"));
+	Container->Calls.Reset();
+	Container->SetOptions({ UpdatedOption, Options[0], Options[4], Options[2] });
+
+	TestEqual(TEXT("Calls of a keyed reorder"), FString::Join(Container->Calls, TEXT(", ")),
+		FString(TEXT("Changing, Removed 1, Moved 3 0, Updated 0, Moved 0 1, Inserted 2, Moved 2 3, Changed, Selected 3")));
+	TestEqual(TEXT("The current index follows the selected option"), Container->GetCurrentIndex(), 3);
+	TestTrue(TEXT("The updated option is in place"), Container->GetOptionAtIndex(0).Text.EqualTo(UpdatedOption.Text));
+
+	// Remove the selected option
+	Container->Calls.Reset();
+	Container->SetOptions({ UpdatedOption, Options[0], Options[4] });
+
+	TestEqual(TEXT("Calls of removing the selected option"), FString::Join(Container->Calls, TEXT(", ")),
+		FString(TEXT("Changing, Removed 3, Changed, Selected -1")));
+	TestEqual(TEXT("Nothing is selected once the selected option is gone"), Container->GetCurrentIndex(), -1);
+
+	// The same options again change nothing
+	Container->Calls.Reset();
+	Container->SetOptions({ UpdatedOption, Options[0], Options[4] });
+
+	TestEqual(TEXT("Calls of identical options"), FString::Join(Container->Calls, TEXT(", ")), FString(TEXT("Changing, Changed")));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWidgetStudioContainerOptionsSourceTest, "WidgetStudio.Widgets.ContainerOptionsSource",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWidgetStudioContainerOptionsSourceTest::RunTest(const FString& Parameters)
+{
+	UWidgetStudioContainer* Source = Cast<UWidgetStudioContainer>(FWidgetStudioTestRenderer::CreateTestWidget(UWidgetStudioTestContainer::StaticClass()));
+	UWidgetStudioContainer* Reader = Cast<UWidgetStudioContainer>(FWidgetStudioTestRenderer::CreateTestWidget(UWidgetStudioTestContainer::StaticClass()));
+	Source->SetOptions(FWidgetStudioTestRenderer::MakeOptions(3));
+
+	Reader->SetOptionsSource(Source);
+	TestEqual(TEXT("The reader reads the options of the source"), Reader->GetOptionCount(), 3);
+	TestTrue(TEXT("The reader reads without a copy"), Reader->GetOptionsView().GetData() == Source->GetOptionsView().GetData());
+
+	// The source reading back from the reader would loop
+	AddExpectedError(TEXT("the options would be read in a loop"), EAutomationExpectedErrorFlags::Contains, 1);
+	Source->SetOptionsSource(Reader);
+	TestEqual(TEXT("The source keeps its own options"), Source->GetOptionCount(), 3);
+
+	Reader->SetOptionsSource(nullptr);
+	TestEqual(TEXT("The reader keeps a copy of the options"), Reader->GetOptionCount(), 3);
+	TestTrue(TEXT("The reader owns the options"), Reader->GetOptionsView().GetData() != Source->GetOptionsView().GetData());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWidgetStudioTabBarKeepsButtonsTest, "WidgetStudio.Widgets.TabBarKeepsButtons",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWidgetStudioTabBarKeepsButtonsTest::RunTest(const FString& Parameters)
+{
+	if (!FWidgetStudioTestRenderer::CanDraw())
+	{
+		AddWarning(TEXT("Slate is not initialized, the tab bar can't be built"));
+		return true;
+	}
+
+	const TArray<FButtonOptions> Options = FWidgetStudioTestRenderer::MakeOptions(6);
+
+	FWidgetStudioTestRenderer Renderer;
+	UWidgetStudioTestTabBar* TabBar = Cast<UWidgetStudioTestTabBar>(FWidgetStudioTestRenderer::CreateTestWidget(UWidgetStudioTestTabBar::StaticClass()));
+	Renderer.DrawFrame(TabBar);
+	TabBar->SetOptions({ Options[0], Options[1], Options[2], Options[3], Options[4] });
+	Renderer.DrawFrame(TabBar);
+
+	TArray<UWidgetStudioModernButton*> PreviousButtons;
+	for (int32 i = 0; i < 5; i++)
+	{
+		PreviousButtons.Add(TabBar->GetOptionButton(i));
+		TestNotNull(FString::Printf(TEXT("Option %d has a button"), i), PreviousButtons[i]);
+	}
+
+	// Insert a new option at the front, remove the middle one and reverse the rest
+	TabBar->SetOptions({ Options[5], Options[4], Options[3], Options[1], Options[0] });
+	Renderer.DrawFrame(TabBar);
+
+	TestTrue(TEXT("Option 4 keeps its button"), TabBar->GetOptionButton(1) == PreviousButtons[4]);
+	TestTrue(TEXT("Option 3 keeps its button"), TabBar->GetOptionButton(2) == PreviousButtons[3]);
+	TestTrue(TEXT("Option 1 keeps its button"), TabBar->GetOptionButton(3) == PreviousButtons[1]);
+	TestTrue(TEXT("Option 0 keeps its button"), TabBar->GetOptionButton(4) == PreviousButtons[0]);
+
+	// The inserted option reuses the button of the removed one
+	TestTrue(TEXT("The inserted option reuses the removed option's button"), TabBar->GetOptionButton(0) == PreviousButtons[2]);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWidgetStudioContainerOptionsTest, "WidgetStudio.Performance.ContainerOptions",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FWidgetStudioContainerOptionsTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumSizes = 2;
+	const int32 Sizes[NumSizes] = { 1000, 10000 };
+	double TabBarBuildTime[NumSizes] = { 0.0, 0.0 };
+
+	const bool bCanBuildTabBars = FWidgetStudioTestRenderer::CanDraw();
+	if (!bCanBuildTabBars)
+	{
+		AddWarning(TEXT("Slate is not initialized, only the combo box is timed"));
+	}
+
+	FWidgetStudioTestRenderer Renderer;
+	for (int32 SizeIndex = 0; SizeIndex < NumSizes; SizeIndex++)
+	{
+		const int32 NumOptions = Sizes[SizeIndex];
+		const TArray<FButtonOptions> Options = FWidgetStudioTestRenderer::MakeOptions(NumOptions);
+
+		// The combo box only flags its menu as outdated when options change, so this times the container alone
+		UWidgetStudioModernComboBox* ComboBox = Cast<UWidgetStudioModernComboBox>(FWidgetStudioTestRenderer::CreateTestWidget(UWidgetStudioModernComboBox::StaticClass()));
+		TArray<FButtonOptions> MovedOptions = Options;
+		double StartTime = FPlatformTime::Seconds();
+		ComboBox->SetOptions(MoveTemp(MovedOptions));
+		const double MoveBuildTime = FPlatformTime::Seconds() - StartTime;
+
+		ComboBox = Cast<UWidgetStudioModernComboBox>(FWidgetStudioTestRenderer::CreateTestWidget(UWidgetStudioModernComboBox::StaticClass()));
+		StartTime = FPlatformTime::Seconds();
+		ComboBox->SetOptions(Options);
+		const double CopyBuildTime = FPlatformTime::Seconds() - StartTime;
+
+		// Set the same options again, only the diff runs
+		StartTime = FPlatformTime::Seconds();
+		ComboBox->SetOptions(Options);
+		const double ResyncTime = FPlatformTime::Seconds() - StartTime;
+
+		// Read every option through the view, without copying the array
+		StartTime = FPlatformTime::Seconds();
+		int32 NumLabels = 0;
+		for (const FButtonOptions& Option : ComboBox->GetOptionsView())
+		{
+			NumLabels += Option.ContentStyle == EButtonContentStyle::Label;
+		}
+		const double ReadTime = FPlatformTime::Seconds() - StartTime;
+
+		// Reference: read every option the way the builds used to, copying the whole array for each one
+		StartTime = FPlatformTime::Seconds();
+		int32 NumCopiedLabels = 0;
+		for (int32 i = 0; i < NumOptions; i++)
+		{
+			NumCopiedLabels += ComboBox->GetOptions()[i].ContentStyle == EButtonContentStyle::Label;
+		}
+		const double CopyReadTime = FPlatformTime::Seconds() - StartTime;
+
+		TestEqual(FString::Printf(TEXT("%d options are all read"), NumOptions), NumLabels, NumOptions);
+		TestEqual(FString::Printf(TEXT("%d options are all read by copy"), NumOptions), NumCopiedLabels, NumOptions);
+		TestTrue(FString::Printf(TEXT("Reading %d options through the view is faster than copying them"), NumOptions), ReadTime < CopyReadTime);
+
+		AddInfo(FString::Printf(TEXT("%d options, combo box: build %.3f ms moved, %.3f ms copied, identical resync %.3f ms, read %.3f ms, read by copy %.3f ms"),
+			NumOptions, MoveBuildTime * 1000.0, CopyBuildTime * 1000.0, ResyncTime * 1000.0, ReadTime * 1000.0, CopyReadTime * 1000.0));
+
+		if (!bCanBuildTabBars)
+		{
+			continue;
+		}
+
+		// The tab bar builds a button for each option it reads from the view
+		UWidgetStudioModernTabBar* TabBar = Cast<UWidgetStudioModernTabBar>(FWidgetStudioTestRenderer::CreateTestWidget(UWidgetStudioModernTabBar::StaticClass()));
+		Renderer.DrawFrame(TabBar);
+		MovedOptions = Options;
+		StartTime = FPlatformTime::Seconds();
+		TabBar->SetOptions(MoveTemp(MovedOptions));
+		TabBarBuildTime[SizeIndex] = FPlatformTime::Seconds() - StartTime;
+
+		TabBar = Cast<UWidgetStudioModernTabBar>(FWidgetStudioTestRenderer::CreateTestWidget(UWidgetStudioModernTabBar::StaticClass()));
+		Renderer.DrawFrame(TabBar);
+		StartTime = FPlatformTime::Seconds();
+		TabBar->SetOptions(Options);
+		const double TabBarCopyBuildTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		TabBar->SetOptions(Options);
+		const double TabBarResyncTime = FPlatformTime::Seconds() - StartTime;
+
+		TestEqual(FString::Printf(TEXT("The tab bar reads %d options"), NumOptions), TabBar->GetOptionCount(), NumOptions);
+
+		AddInfo(FString::Printf(TEXT("%d options, tab bar: build %.3f ms moved, %.3f ms copied, identical resync %.3f ms"),
+			NumOptions, TabBarBuildTime[SizeIndex] * 1000.0, TabBarCopyBuildTime * 1000.0, TabBarResyncTime * 1000.0));
+	}
+
+	// Building ten times the buttons grows linearly, copying the options for each button grew a hundredfold
+	if (bCanBuildTabBars)
+	{
+		TestTrue(TEXT("The tab bar build grows linearly with the options"), TabBarBuildTime[1] < TabBarBuildTime[0] * 30.0);
+	}
+
+	return true;
+}
+
+#endif
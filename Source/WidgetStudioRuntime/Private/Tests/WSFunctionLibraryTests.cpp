@@ -0,0 +1,154 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+
+#include "Tests/WSTestRenderer.h"
+#include "Misc/AutomationTest.h"
+#include "Debugging/SlateDebugging.h"
+#include "Widgets/Layout/SUniformGridPanel.h"
+#include "Widgets/Basic/WSIcon.h"
+#include "Widgets/Modern/WSModernButton.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_SLATE_DEBUGGING
+
+namespace WidgetStudioPrepassTest
+{
+	constexpr int32 NumWidgets = 1000;
+	constexpr int32 NumColumns = 25;
+	constexpr int32 MaxFrames = 600;
+
+	struct FMeasurement
+	{
+		int32 LayoutInvalidations = 0;
+		double PrepassTime = 0.0;
+		int32 AnimatedFrames = 0;
+	};
+
+	/**
+	 * Lays the widgets out in a grid, applies the change to each once they settled, and measures the frames of the
+	 * animation that follows.
+	 */
+	FMeasurement Measure(FWidgetStudioTestRenderer& Renderer, const TArray<UWidgetStudioBase*>& Widgets, TFunctionRef<void(UWidgetStudioBase*)> Change)
+	{
+		FMeasurement Measurement;
+		const TSharedRef<SUniformGridPanel> Grid = SNew(SUniformGridPanel);
+		for (int32 i = 0; i < Widgets.Num(); i++)
+		{
+			Grid->AddSlot(i % NumColumns, i / NumColumns)[Widgets[i]->TakeWidget()];
+		}
+
+		auto IsAnyWidgetAnimating = [&Widgets]()
+		{
+			return Widgets.ContainsByPredicate([](const UWidgetStudioBase* Widget) { return Widget->IsAnimating(); });
+		};
+
+		for (int32 Frame = 0; Frame < MaxFrames && (Frame < 3 || IsAnyWidgetAnimating()); Frame++)
+		{
+			Renderer.DrawFrame(Grid);
+		}
+
+		for (UWidgetStudioBase* Widget : Widgets)
+		{
+			Change(Widget);
+		}
+
+		const FDelegateHandle InvalidateHandle = FSlateDebugging::WidgetInvalidateEvent.AddLambda(
+			[&Measurement](const FSlateDebuggingInvalidateArgs& Args)
+			{
+				if (EnumHasAnyFlags(Args.InvalidateWidgetReason, EInvalidateWidgetReason::Layout))
+				{
+					Measurement.LayoutInvalidations++;
+				}
+			});
+
+		// Frames keep running until the animation settled, a frame longer so the last tick's changes are prepassed
+		for (int32 Frame = 0; Frame < MaxFrames && (Frame < 3 || IsAnyWidgetAnimating()); Frame++)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			Grid->SlatePrepass(1.f);
+			Measurement.PrepassTime += FPlatformTime::Seconds() - StartTime;
+
+			Renderer.DrawFrame(Grid);
+			Measurement.AnimatedFrames++;
+		}
+
+		FSlateDebugging::WidgetInvalidateEvent.Remove(InvalidateHandle);
+		return Measurement;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWidgetStudioRenderTransformPrepassTest, "WidgetStudio.Performance.RenderTransformPrepass",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FWidgetStudioRenderTransformPrepassTest::RunTest(const FString& Parameters)
+{
+	using namespace WidgetStudioPrepassTest;
+
+	if (!FWidgetStudioTestRenderer::CanDraw())
+	{
+		AddWarning(TEXT("Slate is not initialized, the widgets can't be painted"));
+		return true;
+	}
+
+	FWidgetStudioTestRenderer Renderer(FVector2D(2048.f, 2048.f));
+	FMeasurement Buttons[2];
+	FMeasurement Icons[2];
+
+	// Run each benchmark with layout driven animations, then with render transform ones
+	for (int32 Mode = 0; Mode < 2; Mode++)
+	{
+		// Hover a grid of icon buttons
+		TArray<UWidgetStudioBase*> Widgets;
+		for (int32 i = 0; i < NumWidgets; i++)
+		{
+			UWidgetStudioModernButton* Button = Cast<UWidgetStudioModernButton>(FWidgetStudioTestRenderer::CreateTestWidget(UWidgetStudioModernButton::StaticClass()));
+			Button->bAnimateWithRenderTransform = Mode == 1;
+			Button->SetOptions(FButtonOptions(EButtonContentStyle::Icon));
+			Widgets.Add(Button);
+		}
+
+		Buttons[Mode] = Measure(Renderer, Widgets, [](UWidgetStudioBase* Widget)
+		{
+			Widget->TakeWidget()->OnMouseEnter(Widget->GetCachedGeometry(), FPointerEvent());
+		});
+
+		// Grow a grid of icons
+		Widgets.Reset();
+		for (int32 i = 0; i < NumWidgets; i++)
+		{
+			UWidgetStudioIcon* Icon = Cast<UWidgetStudioIcon>(FWidgetStudioTestRenderer::CreateTestWidget(UWidgetStudioIcon::StaticClass()));
+			Icon->bAnimateWithRenderTransform = Mode == 1;
+			Widgets.Add(Icon);
+		}
+
+		Icons[Mode] = Measure(Renderer, Widgets, [](UWidgetStudioBase* Widget)
+		{
+			Cast<UWidgetStudioIcon>(Widget)->SetSize(48.f);
+		});
+	}
+
+	const TCHAR* ModeNames[2] = { TEXT("layout"), TEXT("render transform") };
+	for (int32 Mode = 0; Mode < 2; Mode++)
+	{
+		AddInfo(FString::Printf(TEXT("%d buttons hovering, %s animation: %d layout invalidations, %.3f ms of prepass over %d frames"),
+			NumWidgets, ModeNames[Mode], Buttons[Mode].LayoutInvalidations, Buttons[Mode].PrepassTime * 1000.0, Buttons[Mode].AnimatedFrames));
+		AddInfo(FString::Printf(TEXT("%d icons growing, %s animation: %d layout invalidations, %.3f ms of prepass over %d frames"),
+			NumWidgets, ModeNames[Mode], Icons[Mode].LayoutInvalidations, Icons[Mode].PrepassTime * 1000.0, Icons[Mode].AnimatedFrames));
+	}
+
+	// The button hover effects only move and fade their layers, which never resizes the layout in either mode
+	TestTrue(TEXT("Render transform animations don't invalidate the layout of hovering buttons more"), Buttons[1].LayoutInvalidations <= Buttons[0].LayoutInvalidations);
+
+	// Render transform animations resize the layout once per icon, instead of on every frame they move
+	TestTrue(TEXT("Render transform animations invalidate the layout of growing icons less"), Icons[1].LayoutInvalidations < Icons[0].LayoutInvalidations);
+
+	return true;
+}
+
+#endif
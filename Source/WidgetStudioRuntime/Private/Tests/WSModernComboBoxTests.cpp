@@ -0,0 +1,79 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+
+#include "Tests/WSTestRenderer.h"
+#include "Tests/WSTestWidgets.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWidgetStudioComboBoxMenuTest, "WidgetStudio.Performance.ComboBoxMenu",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FWidgetStudioComboBoxMenuTest::RunTest(const FString& Parameters)
+{
+	if (!FWidgetStudioTestRenderer::CanDraw())
+	{
+		AddWarning(TEXT("Slate is not initialized, the menu can't be built"));
+		return true;
+	}
+
+	constexpr int32 NumOptions = 100000;
+	constexpr int32 NumReferenceOptions = 100;
+	constexpr double MaxOpenTime = 0.002;
+
+	FWidgetStudioTestRenderer Renderer;
+	TArray<double> FirstOpenTimes;
+	UWidgetStudioTestComboBox* ComboBox = nullptr;
+	TArray<FButtonOptions> Options;
+
+	for (const int32 NumMenuOptions : { NumReferenceOptions, NumOptions })
+	{
+		ComboBox = Cast<UWidgetStudioTestComboBox>(FWidgetStudioTestRenderer::CreateTestWidget(UWidgetStudioTestComboBox::StaticClass()));
+		ComboBox->SetVirtualizeMenu(true);
+		Renderer.DrawFrame(ComboBox);
+
+		Options = FWidgetStudioTestRenderer::MakeOptions(NumMenuOptions);
+		ComboBox->SetOptions(Options);
+
+		// Open the way the menu anchor does. The first open also creates the menu and the buttons in view.
+		const double StartTime = FPlatformTime::Seconds();
+		UUserWidget* Menu = ComboBox->OpenMenu();
+		Menu->TakeWidget();
+		FirstOpenTimes.Add(FPlatformTime::Seconds() - StartTime);
+
+		Renderer.DrawFrame(Menu);
+	}
+
+	// Change an option while the menu is closed, so the next open has to pick up the new options
+	Options.Last().Text = FText::FromString(TEXT("Changed"));
+	ComboBox->SetOptions(MoveTemp(Options));
+
+	const double StartTime = FPlatformTime::Seconds();
+	UUserWidget* Menu = ComboBox->OpenMenu();
+	Menu->TakeWidget();
+	const double ReopenTime = FPlatformTime::Seconds() - StartTime;
+
+	TestEqual(TEXT("The menu reads every option"), ComboBox->GetMenu()->GetOptionCount(), NumOptions);
+	TestTrue(TEXT("The menu reads the changed option"), ComboBox->GetMenu()->GetOptionsView().Last().Text.EqualTo(FText::FromString(TEXT("Changed"))));
+
+	// Creating the menu widget and the buttons in view costs the same for any number of options, so the first open
+	// is held against a short list rather than an absolute time
+	TestTrue(FString::Printf(TEXT("The first open of a %d option menu takes under %.0f ms more than of a %d option one"), NumOptions, MaxOpenTime * 1000.0, NumReferenceOptions),
+		FirstOpenTimes[1] < FirstOpenTimes[0] + MaxOpenTime);
+	TestTrue(FString::Printf(TEXT("Opening a %d option menu takes under %.0f ms"), NumOptions, MaxOpenTime * 1000.0), ReopenTime < MaxOpenTime);
+
+	AddInfo(FString::Printf(TEXT("First open %.3f ms with %d options, %.3f ms with %d options, reopen after a change %.3f ms"),
+		FirstOpenTimes[0] * 1000.0, NumReferenceOptions, FirstOpenTimes[1] * 1000.0, NumOptions, ReopenTime * 1000.0));
+
+	return true;
+}
+
+#endif
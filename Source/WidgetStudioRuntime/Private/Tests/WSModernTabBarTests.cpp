@@ -0,0 +1,104 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+
+#include "Tests/WSTestRenderer.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/UObjectArray.h"
+#include "Widgets/Modern/WSModernTabBar.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/* Counts the UObjects created while it exists */
+class FWidgetStudioObjectCreateCounter : public FUObjectArray::FUObjectCreateListener
+{
+
+public:
+
+	FWidgetStudioObjectCreateCounter()
+	{
+		GUObjectArray.AddUObjectCreateListener(this);
+	}
+
+	virtual ~FWidgetStudioObjectCreateCounter()
+	{
+		GUObjectArray.RemoveUObjectCreateListener(this);
+	}
+
+	virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override
+	{
+		NumCreated++;
+	}
+
+	virtual void OnUObjectArrayShutdown() override
+	{
+		GUObjectArray.RemoveUObjectCreateListener(this);
+	}
+
+	int32 NumCreated = 0;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWidgetStudioTabBarButtonPoolTest, "WidgetStudio.Performance.TabBarButtonPool",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FWidgetStudioTabBarButtonPoolTest::RunTest(const FString& Parameters)
+{
+	if (!FWidgetStudioTestRenderer::CanDraw())
+	{
+		AddWarning(TEXT("Slate is not initialized, the tab bar can't be built"));
+		return true;
+	}
+
+	constexpr int32 NumOptions = 50;
+	constexpr int32 NumToggles = 100;
+
+	const TArray<FButtonOptions> AllOptions = FWidgetStudioTestRenderer::MakeOptions(NumOptions);
+	const TArray<FButtonOptions> HalfOptions(AllOptions.GetData(), NumOptions / 2);
+
+	FWidgetStudioTestRenderer Renderer(FVector2D(4000.f, 2000.f));
+	UWidgetStudioModernTabBar* TabBar = Cast<UWidgetStudioModernTabBar>(FWidgetStudioTestRenderer::CreateTestWidget(UWidgetStudioModernTabBar::StaticClass()));
+	TabBar->AddToRoot();
+	TabBar->SetOptions(AllOptions);
+	Renderer.DrawFrame(TabBar);
+
+	// Every toggle re-synchronizes the whole tab bar and shrinks or grows its options
+	int32 NumCreated = 0;
+	double ToggleTime = FPlatformTime::Seconds();
+	{
+		FWidgetStudioObjectCreateCounter CreateCounter;
+		for (int32 Toggle = 0; Toggle < NumToggles; Toggle++)
+		{
+			TabBar->SetOrientation(Toggle % 2 == 0 ? Orient_Vertical : Orient_Horizontal);
+			TabBar->SetOptions(Toggle % 2 == 0 ? HalfOptions : AllOptions);
+			Renderer.DrawFrame(TabBar);
+		}
+		NumCreated = CreateCounter.NumCreated;
+	}
+	ToggleTime = FPlatformTime::Seconds() - ToggleTime;
+
+	const int32 NumObjectsBeforeGC = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	double GCTime = FPlatformTime::Seconds();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	GCTime = FPlatformTime::Seconds() - GCTime;
+	const int32 NumCollected = NumObjectsBeforeGC - GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+	TabBar->RemoveFromRoot();
+
+	AddInfo(FString::Printf(TEXT("%d tab bar toggled %d times: %d UObjects created, %.3f ms"),
+		NumOptions, NumToggles, NumCreated, ToggleTime * 1000.0));
+	AddInfo(FString::Printf(TEXT("Garbage collection after the toggles: %d UObjects collected, %.3f ms"),
+		NumCollected, GCTime * 1000.0));
+
+	// Rebuilding the tabs would create a button hierarchy per tab on every toggle, recycled buttons create none
+	TestTrue(TEXT("Toggling the tab bar creates fewer UObjects than it has tabs"), NumCreated < NumOptions);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,80 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+
+#include "Misc/AutomationTest.h"
+#include "Engine/Engine.h"
+#include "WSSubsystem.h"
+#include "Theme/WSTheme.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWidgetStudioLatestStyleRequestTest, "WidgetStudio.Style.LatestRequestWins",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWidgetStudioLatestStyleRequestTest::RunTest(const FString& Parameters)
+{
+	UWidgetStudioSubsystem* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>() : nullptr;
+	if (!Subsystem)
+	{
+		AddWarning(TEXT("The Widget Studio subsystem is not there"));
+		return true;
+	}
+
+	const TSoftObjectPtr<UWidgetStudioTheme> AsyncTheme(FSoftObjectPath(TEXT("/WidgetStudio/Style/Themes/Theme_Nord_Dark.Theme_Nord_Dark")));
+	const TSoftObjectPtr<UWidgetStudioTheme> SyncTheme(FSoftObjectPath(TEXT("/WidgetStudio/Style/Themes/Theme_Nord_Light.Theme_Nord_Light")));
+	const TSoftObjectPtr<UWidgetStudioTheme> OriginalTheme(Subsystem->GetTheme());
+
+	// A resident theme is applied right away, so the async request would never be in flight
+	if (AsyncTheme.Get())
+	{
+		AddWarning(TEXT("The async theme is already loaded, the request can't be left in flight"));
+		return true;
+	}
+
+	struct FLoadResult
+	{
+		bool bCompleted = false;
+		bool bSuccess = false;
+	};
+	const TSharedRef<FLoadResult> Result = MakeShared<FLoadResult>();
+
+	Subsystem->RequestThemeAsync(AsyncTheme, FOnStyleLoaded::CreateLambda([Result](const bool bSuccess)
+	{
+		Result->bCompleted = true;
+		Result->bSuccess = bSuccess;
+	}));
+
+	// The sync set is the newest request, so it has to survive the async load finishing
+	if (!TestTrue(TEXT("The sync theme is set"), Subsystem->SetTheme(SyncTheme)))
+	{
+		return false;
+	}
+	UWidgetStudioTheme* SyncLoadedTheme = Subsystem->GetTheme();
+
+	const double StartTime = FPlatformTime::Seconds();
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Subsystem, Result, SyncLoadedTheme, OriginalTheme, StartTime]()
+	{
+		if (!Result->bCompleted && FPlatformTime::Seconds() - StartTime < 10.0)
+		{
+			return false;
+		}
+
+		TestTrue(TEXT("The async load finished"), Result->bCompleted);
+		TestFalse(TEXT("The superseded async load reports failure"), Result->bSuccess);
+		TestTrue(TEXT("The sync theme is still set"), Subsystem->GetTheme() == SyncLoadedTheme);
+
+		Subsystem->SetTheme(OriginalTheme);
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
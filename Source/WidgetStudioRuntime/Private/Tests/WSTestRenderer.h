@@ -0,0 +1,131 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "WSTweenScheduler.h"
+#include "Widgets/WSBase.h"
+#include "Widgets/Modern/WSModernButton.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Slate/WidgetRenderer.h"
+
+/**
+ * Draws Widget Studio widgets offscreen for automation tests, stepping the tween scheduler between frames the way the
+ * animation clock does.
+ */
+class FWidgetStudioTestRenderer
+{
+
+public:
+
+	explicit FWidgetStudioTestRenderer(const FVector2D InDrawSize = FVector2D(400.f, 300.f))
+		: DrawSize(InDrawSize)
+	{
+		RenderTarget = FWidgetRenderer::CreateTargetFor(DrawSize, TF_Bilinear, false);
+		RenderTarget->AddToRoot();
+	}
+
+	~FWidgetStudioTestRenderer()
+	{
+		RenderTarget->RemoveFromRoot();
+	}
+
+	/**
+	* Check whether widgets can be drawn -- Slate and its renderer are not there in every automation context
+	* @return true if the Slate application is initialized
+	*/
+	static bool CanDraw()
+	{
+		return FSlateApplication::IsInitialized();
+	}
+
+	/**
+	* Create a widget the way CreateWidget does, without an owning world
+	* @param WidgetClass - the class of the widget
+	* @return the initialized widget
+	*/
+	static UWidgetStudioBase* CreateTestWidget(UClass* WidgetClass)
+	{
+		UWidgetStudioBase* Widget = NewObject<UWidgetStudioBase>(GetTransientPackage(), WidgetClass);
+		Widget->Initialize();
+		return Widget;
+	}
+
+	/**
+	* Make label options with unique keys, for containers
+	* @param NumOptions - the number of options
+	* @return the options, labeled and keyed by their index
+	*/
+	static TArray<FButtonOptions> MakeOptions(const int32 NumOptions)
+	{
+		TArray<FButtonOptions> Options;
+		Options.Reserve(NumOptions);
+		for (int32 i = 0; i < NumOptions; i++)
+		{
+			FButtonOptions& Option = Options.Emplace_GetRef(EButtonContentStyle::Label, false, FText::AsNumber(i));
+			Option.Key = FName(TEXT("Option"), i + 1);
+		}
+		return Options;
+	}
+
+	/**
+	* Draw a frame of a widget, then step the tween scheduler
+	* @param Widget - the widget to draw
+	* @param DeltaTime - the time the frame steps forward
+	*/
+	void DrawFrame(UWidget* Widget, const float DeltaTime = 1.f / 60.f)
+	{
+		DrawFrame(Widget->TakeWidget(), DeltaTime);
+	}
+
+	/**
+	* Draw a frame of a Slate widget, then step the tween scheduler
+	* @param Widget - the widget to draw, usually a panel holding several Widget Studio widgets
+	* @param DeltaTime - the time the frame steps forward
+	*/
+	void DrawFrame(const TSharedRef<SWidget>& Widget, const float DeltaTime = 1.f / 60.f)
+	{
+		Renderer.DrawWidget(RenderTarget, Widget, DrawSize, DeltaTime);
+		FWidgetStudioTweenScheduler::Get().Tick(DeltaTime);
+	}
+
+	/**
+	* Draw frames of a widget until its animations settled and a few frames passed without any, so the animation
+	* targets marked dirty by the last change were refreshed
+	* @param Widget - the widget to draw
+	* @param MaxFrames - the number of frames after which the widget is considered to never settle
+	* @return true if the widget settled
+	*/
+	bool Settle(UWidgetStudioBase* Widget, const int32 MaxFrames = 600)
+	{
+		constexpr int32 SettledFrames = 3;
+		int32 FramesWithoutAnimation = 0;
+		for (int32 Frame = 0; Frame < MaxFrames && FramesWithoutAnimation < SettledFrames; Frame++)
+		{
+			DrawFrame(Widget);
+			FramesWithoutAnimation = Widget->IsAnimating() ? 0 : FramesWithoutAnimation + 1;
+		}
+		return FramesWithoutAnimation >= SettledFrames;
+	}
+
+private:
+
+	FWidgetRenderer Renderer;
+
+	UTextureRenderTarget2D* RenderTarget = nullptr;
+
+	FVector2D DrawSize;
+};
+
+#endif
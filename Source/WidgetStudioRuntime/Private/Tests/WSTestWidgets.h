@@ -0,0 +1,77 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Widgets/WSContainer.h"
+#include "Widgets/Modern/WSModernComboBox.h"
+#include "Widgets/Modern/WSModernTabBar.h"
+#include "WSTestWidgets.generated.h"
+
+/**
+ * A container that records the Set Options callbacks and the broadcast current index, for automation tests
+ */
+UCLASS(Transient, HideDropdown)
+class UWidgetStudioTestContainer : public UWidgetStudioContainer
+{
+	GENERATED_BODY()
+
+public:
+
+	/** The calls recorded since the last reset, e.g. "Moved 3 0". */
+	TArray<FString> Calls;
+
+	/** Record the broadcasts of OnCurrentIndexChanged as "Selected <index>". */
+	UFUNCTION()
+	void RecordCurrentIndex(int32 Index, FButtonOptions Option)
+	{
+		Calls.Add(FString::Printf(TEXT("Selected %d"), Index));
+	}
+
+protected:
+
+	virtual void OnOptionsChanging() override { Calls.Add(TEXT("Changing")); }
+	virtual void OnOptionRemoved(int32 Index) override { Calls.Add(FString::Printf(TEXT("Removed %d"), Index)); }
+	virtual void OnOptionInserted(int32 Index) override { Calls.Add(FString::Printf(TEXT("Inserted %d"), Index)); }
+	virtual void OnOptionMoved(int32 FromIndex, int32 ToIndex) override { Calls.Add(FString::Printf(TEXT("Moved %d %d"), FromIndex, ToIndex)); }
+	virtual void OnOptionUpdated(int32 Index) override { Calls.Add(FString::Printf(TEXT("Updated %d"), Index)); }
+	virtual void OnOptionsChanged() override { Calls.Add(TEXT("Changed")); }
+};
+
+/**
+ * A tab bar that exposes the buttons of its options, for automation tests
+ */
+UCLASS(Transient, HideDropdown)
+class UWidgetStudioTestTabBar : public UWidgetStudioModernTabBar
+{
+	GENERATED_BODY()
+
+public:
+
+	using UWidgetStudioModernTabBar::GetOptionButton;
+};
+
+/**
+ * A combo box that opens its menu without a menu anchor, for automation tests
+ */
+UCLASS(Transient, HideDropdown)
+class UWidgetStudioTestComboBox : public UWidgetStudioModernComboBox
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Build the menu the way the menu anchor does when it opens, and return it. */
+	UUserWidget* OpenMenu() { return ConstructMenu(); }
+
+	/** Returns the menu, or nullptr if it was never opened. */
+	UWidgetStudioModernTabBar* GetMenu() const { return Menu; }
+};
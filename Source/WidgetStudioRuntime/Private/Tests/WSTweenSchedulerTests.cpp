@@ -0,0 +1,110 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+
+#include "WSTweenScheduler.h"
+#include "Misc/AutomationTest.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/* The per-channel, one tween at a time version of the tween kernel, as a reference for its results and timing */
+static void AdvanceTweensScalar(float* Current, float* Start, const float* Target, const float* Weights,
+	const float* Epsilons, const float* Durations, const int32 NumTweens)
+{
+	for (int32 i = 0; i < NumTweens; i++)
+	{
+		for (int32 Channel = i * 4; Channel < i * 4 + 4; Channel++)
+		{
+			const float NewValue = Start[Channel] + (Target[Channel] - Start[Channel]) * Weights[i];
+			const bool bMoving = Durations[i] > 0.f || FMath::Abs(Target[Channel] - NewValue) > Epsilons[i];
+			Current[Channel] = bMoving ? NewValue : Target[Channel];
+			Start[Channel] = Durations[i] > 0.f ? Start[Channel] : Current[Channel];
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWidgetStudioTweenKernelTest, "WidgetStudio.Performance.TweenKernel",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FWidgetStudioTweenKernelTest::RunTest(const FString& Parameters)
+{
+	constexpr int32 NumTweens = 10000;
+	constexpr int32 NumSteps = 100;
+
+	TArray<float, TAlignedHeapAllocator<16>> Current;
+	TArray<float, TAlignedHeapAllocator<16>> Start;
+	TArray<float, TAlignedHeapAllocator<16>> Target;
+	TArray<float> Weights;
+	TArray<float> Epsilons;
+	TArray<float> Durations;
+
+	// Every fourth tween is timed, the others are exponential tweens running at the default animation time of 60 Hz
+	FRandomStream Random(1234);
+	for (int32 i = 0; i < NumTweens; i++)
+	{
+		for (int32 Channel = 0; Channel < 4; Channel++)
+		{
+			Start.Add(Random.FRandRange(0.f, 100.f));
+			Target.Add(Random.FRandRange(0.f, 100.f));
+		}
+		Weights.Add(7.f / 60.f);
+		Epsilons.Add(0.1f);
+		Durations.Add(i % 4 == 0 ? 0.25f : 0.f);
+	}
+	Current = Start;
+
+	// The kernel matches the scalar reference
+	TArray<float, TAlignedHeapAllocator<16>> KernelCurrent = Current;
+	TArray<float, TAlignedHeapAllocator<16>> KernelStart = Start;
+	TArray<float, TAlignedHeapAllocator<16>> ScalarCurrent = Current;
+	TArray<float, TAlignedHeapAllocator<16>> ScalarStart = Start;
+
+	FWidgetStudioTweenScheduler::AdvanceTweens(KernelCurrent.GetData(), KernelStart.GetData(), Target.GetData(), Weights.GetData(), Epsilons.GetData(), Durations.GetData(), NumTweens);
+	AdvanceTweensScalar(ScalarCurrent.GetData(), ScalarStart.GetData(), Target.GetData(), Weights.GetData(), Epsilons.GetData(), Durations.GetData(), NumTweens);
+
+	// A fused multiply-add may round a channel to the other side of its settle epsilon, so it can differ by up to that
+	for (int32 Channel = 0; Channel < NumTweens * 4; Channel++)
+	{
+		const float Tolerance = Epsilons[Channel / 4] + KINDA_SMALL_NUMBER;
+		if (!FMath::IsNearlyEqual(KernelCurrent[Channel], ScalarCurrent[Channel], Tolerance) ||
+			!FMath::IsNearlyEqual(KernelStart[Channel], ScalarStart[Channel], Tolerance))
+		{
+			AddError(FString::Printf(TEXT("Tween %d channel %d differs from the scalar reference"), Channel / 4, Channel % 4));
+			return false;
+		}
+	}
+
+	// Time both over the same steps
+	KernelCurrent = Current;
+	KernelStart = Start;
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Step = 0; Step < NumSteps; Step++)
+	{
+		FWidgetStudioTweenScheduler::AdvanceTweens(KernelCurrent.GetData(), KernelStart.GetData(), Target.GetData(), Weights.GetData(), Epsilons.GetData(), Durations.GetData(), NumTweens);
+	}
+	const double KernelTime = FPlatformTime::Seconds() - StartTime;
+
+	ScalarCurrent = Current;
+	ScalarStart = Start;
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Step = 0; Step < NumSteps; Step++)
+	{
+		AdvanceTweensScalar(ScalarCurrent.GetData(), ScalarStart.GetData(), Target.GetData(), Weights.GetData(), Epsilons.GetData(), Durations.GetData(), NumTweens);
+	}
+	const double ScalarTime = FPlatformTime::Seconds() - StartTime;
+
+	const double NanosecondsPerTween = 1e9 / (NumTweens * NumSteps);
+	AddInfo(FString::Printf(TEXT("%d tweens, %d steps: SIMD kernel %.2f ns per tween, scalar %.2f ns per tween"),
+		NumTweens, NumSteps, KernelTime * NanosecondsPerTween, ScalarTime * NanosecondsPerTween));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,27 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+#include "Theme/WSIconSet.h"
+#include "WSSubsystem.h"
+#include "Engine/Engine.h"
+
+#if WITH_EDITOR
+void UWidgetStudioIconSet::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Textures of the active icon set are cached by the subsystem, refresh them so widgets pick up the edit
+	if (!GEngine) return;
+	UWidgetStudioSubsystem* WSSubsystem = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
+	if (WSSubsystem && WSSubsystem->GetIconSet() == this)
+	{
+		WSSubsystem->BroadcastStyleChanged(EWSStyleChange::IconSet);
+	}
+}
+#endif
@@ -8,6 +8,8 @@
 */
 
 #include "Theme/WSTheme.h"
+#include "WSSubsystem.h"
+#include "Engine/Engine.h"
 
 UWidgetStudioTheme::UWidgetStudioTheme()
 {
@@ -20,3 +22,18 @@ UWidgetStudioTheme::UWidgetStudioTheme()
 	SecondaryBackground.A = 1.f;
 	TertiaryBackground.A = 1.f;
 }
+
+#if WITH_EDITOR
+void UWidgetStudioTheme::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Colors of the active theme are cached by the subsystem, refresh them so widgets pick up the edit
+	if (!GEngine) return;
+	UWidgetStudioSubsystem* WSSubsystem = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
+	if (WSSubsystem && WSSubsystem->GetTheme() == this)
+	{
+		WSSubsystem->BroadcastStyleChanged(EWSStyleChange::Palette);
+	}
+}
+#endif
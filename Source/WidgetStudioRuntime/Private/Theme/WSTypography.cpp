@@ -0,0 +1,46 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+#include "Theme/WSTypography.h"
+#include "WSSubsystem.h"
+#include "Engine/Engine.h"
+
+FFontStyle UWidgetStudioTypography::GetTypeScale(const EWSFontType FontType) const
+{
+	if (FontType == EWSFontType::H1)				{ return H1; }
+	if (FontType == EWSFontType::H2)				{ return H2; }
+	if (FontType == EWSFontType::H3)				{ return H3; }
+	if (FontType == EWSFontType::H4)				{ return H4; }
+	if (FontType == EWSFontType::H5)				{ return H5; }
+	if (FontType == EWSFontType::H6)				{ return H6; }
+	if (FontType == EWSFontType::Subtitle1)			{ return Subtitle1; }
+	if (FontType == EWSFontType::Subtitle2)			{ return Subtitle2; }
+	if (FontType == EWSFontType::Body1)				{ return Body1; }
+	if (FontType == EWSFontType::Body2)				{ return Body2; }
+	if (FontType == EWSFontType::Button)			{ return Button; }
+	if (FontType == EWSFontType::Caption)			{ return Caption; }
+	if (FontType == EWSFontType::Overline)			{ return Overline; }
+
+	return FFontStyle();
+}
+
+#if WITH_EDITOR
+void UWidgetStudioTypography::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Fonts of the active typography are prebuilt by the subsystem, refresh them so widgets pick up the edit
+	if (!GEngine) return;
+	UWidgetStudioSubsystem* WSSubsystem = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
+	if (WSSubsystem && WSSubsystem->GetTypography() == this)
+	{
+		WSSubsystem->BroadcastStyleChanged(EWSStyleChange::Typography);
+	}
+}
+#endif
@@ -0,0 +1,131 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+
+
+#include "WSAnimationClock.h"
+#include "Framework/Application/SlateApplication.h"
+
+TUniquePtr<FWidgetStudioAnimationClock> FWidgetStudioAnimationClock::Instance;
+
+static TAutoConsoleVariable<float> CVarWidgetStudioAnimationRate(
+	TEXT("WidgetStudio.AnimationRate"),
+	0.f,
+	TEXT("Number of times per second Widget Studio animations are updated. 0 updates them every frame."),
+	ECVF_Default);
+
+void FWidgetStudioAnimationClock::Initialize()
+{
+	if (Instance) return;
+
+	Instance = TUniquePtr<FWidgetStudioAnimationClock>(new FWidgetStudioAnimationClock());
+}
+
+void FWidgetStudioAnimationClock::Shutdown()
+{
+	Instance.Reset();
+}
+
+FWidgetStudioAnimationClock& FWidgetStudioAnimationClock::Get()
+{
+	check(Instance);
+	return *Instance;
+}
+
+FWidgetStudioAnimationClock::~FWidgetStudioAnimationClock()
+{
+	Stop();
+}
+
+FDelegateHandle FWidgetStudioAnimationClock::AddListener(FOnWidgetStudioAnimationClockTick::FDelegate&& Delegate)
+{
+	const bool bWasRunning = OnTick.IsBound();
+	const FDelegateHandle Handle = OnTick.Add(MoveTemp(Delegate));
+
+	if (!bWasRunning)
+	{
+		Start();
+	}
+	return Handle;
+}
+
+void FWidgetStudioAnimationClock::RemoveListener(const FDelegateHandle Handle)
+{
+	OnTick.Remove(Handle);
+
+	if (!OnTick.IsBound())
+	{
+		Stop();
+	}
+}
+
+void FWidgetStudioAnimationClock::Start()
+{
+	AccumulatedTime = 0.f;
+
+	if (FSlateApplication::IsInitialized())
+	{
+		if (!SlateTickHandle.IsValid())
+		{
+			SlateTickHandle = FSlateApplication::Get().OnPreTick().AddRaw(this, &FWidgetStudioAnimationClock::Advance);
+		}
+		return;
+	}
+
+	if (!TickerHandle.IsValid())
+	{
+#if ENGINE_MAJOR_VERSION == 4
+		TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](const float FrameDeltaTime)
+#else
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](const float FrameDeltaTime)
+#endif
+		{
+			Advance(FrameDeltaTime);
+			return true;
+		}));
+	}
+}
+
+void FWidgetStudioAnimationClock::Stop()
+{
+	if (SlateTickHandle.IsValid())
+	{
+		if (FSlateApplication::IsInitialized())
+		{
+			FSlateApplication::Get().OnPreTick().Remove(SlateTickHandle);
+		}
+		SlateTickHandle.Reset();
+	}
+
+	if (TickerHandle.IsValid())
+	{
+#if ENGINE_MAJOR_VERSION == 4
+		FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#else
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+#endif
+		TickerHandle.Reset();
+	}
+}
+
+void FWidgetStudioAnimationClock::Advance(const float FrameDeltaTime)
+{
+	AccumulatedTime += FrameDeltaTime;
+
+	// Step once the interval is reached, within half a frame so frame time jitter does not skip a whole frame
+	const float Rate = CVarWidgetStudioAnimationRate.GetValueOnGameThread();
+	if (Rate > 0.f && AccumulatedTime + FrameDeltaTime * .5f < 1.f / Rate)
+	{
+		return;
+	}
+
+	DeltaTime = AccumulatedTime;
+	AccumulatedTime = 0.f;
+	OnTick.Broadcast(DeltaTime);
+}
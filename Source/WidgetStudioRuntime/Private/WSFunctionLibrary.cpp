@@ -9,155 +9,170 @@
 
 #include "WSFunctionLibrary.h"
 #include "WSSubsystem.h"
+#include "WSMaterialRegistry.h"
+#include "WSTweenScheduler.h"
 #include "Brushes/SlateImageBrush.h"
-#include "Kismet/KismetMathLibrary.h"
 #include "Engine/Font.h"
 #include "Engine/Engine.h"
+#include "Engine/LatentActionManager.h"
+#include "LatentActions.h"
+#include "Misc/ConfigCacheIni.h"
 #include "Runtime/Launch/Resources/Version.h"
 
+static TAutoConsoleVariable<int32> CVarWidgetStudioQuality(
+	TEXT("sg.WidgetStudioQuality"),
+	3,
+	TEXT("Widget Studio visual quality.\n")
+	TEXT(" 0: Low, no drop shadows and no animations\n")
+	TEXT(" 1: Medium, no drop shadows, color and opacity fades only\n")
+	TEXT(" 2: High, everything\n")
+	TEXT(" 3: Epic, everything\n")
+	TEXT("Each tier can be tuned in the [WidgetStudioQuality@<Level>] sections of the scalability ini."),
+	ECVF_ScalabilityGroup);
+
+/**
+ * Effects enabled at one quality level
+ */
+struct FWidgetStudioQualityTier
+{
+	bool bDropShadows = true;
+	bool bAnimateFades = true;
+	bool bAnimateMotion = true;
+};
+
+/**
+ * Return the effects of the current quality level.
+ * Read once per level from the [WidgetStudioQuality@<Level>] section of the scalability ini, keys missing there keep
+ * the defaults listed in the help of sg.WidgetStudioQuality.
+ */
+static const FWidgetStudioQualityTier& GetQualityTier()
+{
+	static TOptional<FWidgetStudioQualityTier> Tiers[4];
+
+	const int32 Level = UWidgetStudioFunctionLibrary::GetQualityLevel();
+	TOptional<FWidgetStudioQualityTier>& Tier = Tiers[Level];
+	if (!Tier.IsSet())
+	{
+		FWidgetStudioQualityTier NewTier;
+		NewTier.bDropShadows = Level >= 2;
+		NewTier.bAnimateFades = Level >= 1;
+		NewTier.bAnimateMotion = Level >= 2;
+
+		if (GConfig)
+		{
+			const FString Section = FString::Printf(TEXT("WidgetStudioQuality@%d"), Level);
+			GConfig->GetBool(*Section, TEXT("bDropShadows"), NewTier.bDropShadows, GScalabilityIni);
+			GConfig->GetBool(*Section, TEXT("bAnimateFades"), NewTier.bAnimateFades, GScalabilityIni);
+			GConfig->GetBool(*Section, TEXT("bAnimateMotion"), NewTier.bAnimateMotion, GScalabilityIni);
+		}
+
+		Tier = NewTier;
+	}
+
+	return Tier.GetValue();
+}
+
+/**
+ * Latent action that completes once an asynchronous style change has finished
+ */
+class FWidgetStudioStyleLoadAction : public FPendingLatentAction
+{
+public:
+	FName ExecutionFunction;
+	int32 OutputLink;
+	FWeakObjectPtr CallbackTarget;
+	bool& bSuccess;
+
+	/* Shared with the load callback, which may outlive this action */
+	TSharedRef<TOptional<bool>> Result = MakeShared<TOptional<bool>>();
+
+	FWidgetStudioStyleLoadAction(const FLatentActionInfo& LatentInfo, bool& bInSuccess)
+		: ExecutionFunction(LatentInfo.ExecutionFunction)
+		, OutputLink(LatentInfo.Linkage)
+		, CallbackTarget(LatentInfo.CallbackTarget)
+		, bSuccess(bInSuccess)
+	{
+	}
+
+	FOnStyleLoaded MakeCompletionDelegate() const
+	{
+		TSharedRef<TOptional<bool>> SharedResult = Result;
+		return FOnStyleLoaded::CreateLambda([SharedResult](const bool bLoaded)
+		{
+			*SharedResult = bLoaded;
+		});
+	}
+
+	virtual void UpdateOperation(FLatentResponse& Response) override
+	{
+		if (Result->IsSet())
+		{
+			bSuccess = Result->GetValue();
+		}
+		Response.FinishAndTriggerIf(Result->IsSet(), ExecutionFunction, OutputLink, CallbackTarget);
+	}
+};
+
+/**
+ * Register a FWidgetStudioStyleLoadAction with the world of the context object
+ * @return the new action, or nullptr if there is no world or an action with the same UUID is already running
+ */
+static FWidgetStudioStyleLoadAction* AddStyleLoadAction(const UObject* WorldContextObject, const FLatentActionInfo& LatentInfo, bool& bSuccess)
+{
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+	if (!World) { return nullptr; }
+
+	FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+	if (LatentActionManager.FindExistingAction<FWidgetStudioStyleLoadAction>(LatentInfo.CallbackTarget, LatentInfo.UUID))
+	{
+		return nullptr;
+	}
+
+	FWidgetStudioStyleLoadAction* Action = new FWidgetStudioStyleLoadAction(LatentInfo, bSuccess);
+	LatentActionManager.AddNewAction(LatentInfo.CallbackTarget, LatentInfo.UUID, Action);
+	return Action;
+}
+
 FLinearColor UWidgetStudioFunctionLibrary::GetColorFromPalette(const EPalette Color)
 {
+	const UWidgetStudioSubsystem* WSSubsystem = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
 
-	UWidgetStudioSubsystem* WSSubsystem = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
-	
-	// Return blank white if theme is invalid
-	if(!WSSubsystem || !WSSubsystem->GetTheme())
+	// Return blank white if the subsystem is unavailable
+	if (!WSSubsystem)
 	{
 		return FLinearColor(1, 1, 1, 1);
 	}
 
-	// Accent Colors
-	if(Color == EPalette::PrimaryAccent) { return WSSubsystem->GetTheme()->PrimaryAccent; }
-	if(Color == EPalette::SecondaryAccent) { return WSSubsystem->GetTheme()->SecondaryAccent; }
-
-	// Content / Foreground Colors
-	if(Color == EPalette::PrimaryContent) { return WSSubsystem->GetTheme()->PrimaryContent; }
-	if(Color == EPalette::SecondaryContent) { return WSSubsystem->GetTheme()->SecondaryContent; }
-	if(Color == EPalette::TertiaryContent) { return WSSubsystem->GetTheme()->TertiaryContent; }
-
-	// Background Colors
-	if(Color == EPalette::PrimaryBackground) { return WSSubsystem->GetTheme()->PrimaryBackground; }
-	if(Color == EPalette::SecondaryBackground) { return WSSubsystem->GetTheme()->SecondaryBackground; }
-	if(Color == EPalette::TertiaryBackground) { return WSSubsystem->GetTheme()->TertiaryBackground; }
-
-	// Basic Colors
-	if(Color == EPalette::Red)		{ return FLinearColor(.66, 0, .07, 1); }
-	if(Color == EPalette::Orange)	{ return FLinearColor(.99, .32, .18, 1); }
-	if(Color == EPalette::Yellow)	{ return FLinearColor(1, .68, 0, 1); }
-	if(Color == EPalette::Olive)	{ return FLinearColor(.03, .61, .03, 1); }
-	if(Color == EPalette::Green)	{ return FLinearColor(0, .32, .085, 1); }
-	if(Color == EPalette::Teal)		{ return FLinearColor(0, .215, .215, 1); }
-	if(Color == EPalette::Blue)		{ return FLinearColor(0, .155, .48, 1); }
-	if(Color == EPalette::Violet)	{ return FLinearColor(.85, .22, .85, 1); }
-	if(Color == EPalette::Purple)	{ return FLinearColor(.46, .01, .84, 1); }
-	if(Color == EPalette::Pink)		{ return FLinearColor(1, .07, .3, 1); }
-	if(Color == EPalette::Brown)	{ return FLinearColor(.38, .02, .02, 1); }
-	if(Color == EPalette::Grey)		{ return FLinearColor(.35, .35, .35, 1); }
-	if(Color == EPalette::Black)	{ return FLinearColor(0, 0, 0, 1); }
-	if(Color == EPalette::White)	{ return FLinearColor(1, 1, 1, 1); }
-	if(Color == EPalette::Transparent)	{ return FLinearColor(0, 0, 0, 0); }
-
-	// Return blank white if invalid enum
-	return FLinearColor(1, 1, 1, 1);
+	return WSSubsystem->GetPaletteColor(Color);
+}
+
+TArray<FLinearColor> UWidgetStudioFunctionLibrary::GetColorsFromPalette(const TArray<EPalette>& Colors)
+{
+	TArray<FLinearColor> OutColors;
+	OutColors.SetNumUninitialized(Colors.Num());
+
+	const UWidgetStudioSubsystem* WSSubsystem = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
+
+	// Return blank white if the subsystem is unavailable
+	if (!WSSubsystem)
+	{
+		for (FLinearColor& OutColor : OutColors)
+		{
+			OutColor = FLinearColor(1, 1, 1, 1);
+		}
+		return OutColors;
+	}
+
+	WSSubsystem->GetPaletteColors(Colors, OutColors);
+	return OutColors;
 }
 
 UTexture2D* UWidgetStudioFunctionLibrary::GetTextureFromIconLibrary(const EIconItem Icon)
 {
-	UWidgetStudioSubsystem* WF = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
-	if(!IsValid(WF->GetIconSet())) { return nullptr; }
-	
-	if (Icon == EIconItem::Attachment)			{ return WF->GetIconSet()->Attachment; }
-	if (Icon == EIconItem::ArrowDown) 			{ return WF->GetIconSet()->ArrowDown; }
-	if (Icon == EIconItem::ArrowLeft) 			{ return WF->GetIconSet()->ArrowLeft; }
-	if (Icon == EIconItem::ArrowLeftRight)		{ return WF->GetIconSet()->ArrowLeftRight; }
-	if (Icon == EIconItem::ArrowRight)			{ return WF->GetIconSet()->ArrowRight; }
-	if (Icon == EIconItem::ArrowUp)				{ return WF->GetIconSet()->ArrowUp; }
-	if (Icon == EIconItem::ArrowInDown)			{ return WF->GetIconSet()->ArrowInDown; }
-	if (Icon == EIconItem::ArrowInUp)			{ return WF->GetIconSet()->ArrowInUp; }
-	if (Icon == EIconItem::Bookmark) 			{ return WF->GetIconSet()->Bookmark; }
-	if (Icon == EIconItem::Calendar) 			{ return WF->GetIconSet()->Calendar; }
-	if (Icon == EIconItem::ChevronDown) 		{ return WF->GetIconSet()->ChevronDown; }
-	if (Icon == EIconItem::ChevronLeft) 		{ return WF->GetIconSet()->ChevronLeft; }
-	if (Icon == EIconItem::ChevronRight)		{ return WF->GetIconSet()->ChevronRight; }
-	if (Icon == EIconItem::ChevronUp)			{ return WF->GetIconSet()->ChevronUp; }
-	if (Icon == EIconItem::Check)				{ return WF->GetIconSet()->Check; }
-	if (Icon == EIconItem::Clipboard)			{ return WF->GetIconSet()->Clipboard; }
-	if (Icon == EIconItem::Clock) 				{ return WF->GetIconSet()->Clock; }
-	if (Icon == EIconItem::Close) 				{ return WF->GetIconSet()->Close; }
-	if (Icon == EIconItem::Cloud) 				{ return WF->GetIconSet()->Cloud; }
-	if (Icon == EIconItem::CloudDownload)		{ return WF->GetIconSet()->CloudDownload; }
-	if (Icon == EIconItem::CloudUpload)			{ return WF->GetIconSet()->CloudUpload; }
-	if (Icon == EIconItem::CogWheel)			{ return WF->GetIconSet()->Cogwheel; }
-	if (Icon == EIconItem::Compass)				{ return WF->GetIconSet()->Compass; }
-	if (Icon == EIconItem::ControlEnd)			{ return WF->GetIconSet()->ControlEnd; }
-	if (Icon == EIconItem::ControlFastForward)	{ return WF->GetIconSet()->ControlFastForward; }
-	if (Icon == EIconItem::ControlFullscreen)	{ return WF->GetIconSet()->ControlFullScreen; }
-	if (Icon == EIconItem::ControlPause)		{ return WF->GetIconSet()->ControlPause; }
-	if (Icon == EIconItem::ControlPlay)			{ return WF->GetIconSet()->ControlPlay; }
-	if (Icon == EIconItem::ControlRewind)		{ return WF->GetIconSet()->ControlRewind; }
-	if (Icon == EIconItem::ControlStart)		{ return WF->GetIconSet()->ControlStart; }
-	if (Icon == EIconItem::ControlStop)			{ return WF->GetIconSet()->ControlStop; }
-	if (Icon == EIconItem::Desktop)				{ return WF->GetIconSet()->Desktop; }
-	if (Icon == EIconItem::Document)			{ return WF->GetIconSet()->Document; }
-	if (Icon == EIconItem::DocumentCopy)		{ return WF->GetIconSet()->DocumentCopy; }
-	if (Icon == EIconItem::Download) 			{ return WF->GetIconSet()->Download; }
-	if (Icon == EIconItem::Envelope) 			{ return WF->GetIconSet()->Envelope; }
-	if (Icon == EIconItem::Exclamation)			{ return WF->GetIconSet()->Exclamation; }
-	if (Icon == EIconItem::Expand)				{ return WF->GetIconSet()->Expand; }
-	if (Icon == EIconItem::File)				{ return WF->GetIconSet()->File; }
-	if (Icon == EIconItem::FileMinus)			{ return WF->GetIconSet()->FileMinus; }
-	if (Icon == EIconItem::FilePlus)			{ return WF->GetIconSet()->FilePlus; }
-	if (Icon == EIconItem::Folder)				{ return WF->GetIconSet()->Folder; }
-	if (Icon == EIconItem::Globe)				{ return WF->GetIconSet()->Globe; }
-	if (Icon == EIconItem::GridView)			{ return WF->GetIconSet()->GridView; }
-	if (Icon == EIconItem::Hamburger)			{ return WF->GetIconSet()->Hamburger; }
-	if (Icon == EIconItem::Heart)				{ return WF->GetIconSet()->Heart; }
-	if (Icon == EIconItem::Home) 				{ return WF->GetIconSet()->Home; }
-	if (Icon == EIconItem::Info) 				{ return WF->GetIconSet()->Info; }
-	if (Icon == EIconItem::Info) 				{ return WF->GetIconSet()->Info; }
-	if (Icon == EIconItem::Link) 				{ return WF->GetIconSet()->Link; }
-	if (Icon == EIconItem::ListView)			{ return WF->GetIconSet()->ListView; }
-	if (Icon == EIconItem::LockClose)			{ return WF->GetIconSet()->LockClose; }
-	if (Icon == EIconItem::LockOpen)			{ return WF->GetIconSet()->LockOpen; }
-	if (Icon == EIconItem::Magnifier)			{ return WF->GetIconSet()->Magnifier; }
-	if (Icon == EIconItem::MagnifierMinus)		{ return WF->GetIconSet()->MagnifierMinus; }
-	if (Icon == EIconItem::MagnifierPlus)		{ return WF->GetIconSet()->MagnifierPlus; }
-	if (Icon == EIconItem::Map)					{ return WF->GetIconSet()->Map; }
-	if (Icon == EIconItem::Microphone)			{ return WF->GetIconSet()->Microphone; }
-	if (Icon == EIconItem::Minus)				{ return WF->GetIconSet()->Minus; }
-	if (Icon == EIconItem::Mobile)				{ return WF->GetIconSet()->Mobile; }
-	if (Icon == EIconItem::Moon)				{ return WF->GetIconSet()->Moon; }
-	if (Icon == EIconItem::Navigate)			{ return WF->GetIconSet()->Navigate; }
-	if (Icon == EIconItem::Pen)					{ return WF->GetIconSet()->Pen; }
-	if (Icon == EIconItem::Phone) 				{ return WF->GetIconSet()->Phone; }
-	if (Icon == EIconItem::Photo) 				{ return WF->GetIconSet()->Photo; }
-	if (Icon == EIconItem::Pin)					{ return WF->GetIconSet()->Pin; }
-	if (Icon == EIconItem::Plus)				{ return WF->GetIconSet()->Plus; }
-	if (Icon == EIconItem::Power) 				{ return WF->GetIconSet()->Power; }
-	if (Icon == EIconItem::Print) 				{ return WF->GetIconSet()->Print; }
-	if (Icon == EIconItem::Question)			{ return WF->GetIconSet()->Question; }
-	if (Icon == EIconItem::Refresh)				{ return WF->GetIconSet()->Refresh; }
-	if (Icon == EIconItem::ShoppingCart)		{ return WF->GetIconSet()->ShoppingCart; }
-	if (Icon == EIconItem::Settings)			{ return WF->GetIconSet()->Settings; }
-	if (Icon == EIconItem::Share)				{ return WF->GetIconSet()->Share; }
-	if (Icon == EIconItem::ShoppingCart) 		{ return WF->GetIconSet()->ShoppingCart; }
-	if (Icon == EIconItem::SpeechBubble) 		{ return WF->GetIconSet()->SpeechBubble; }
-	if (Icon == EIconItem::StatisticGraph)		{ return WF->GetIconSet()->StatisticGraph; }
-	if (Icon == EIconItem::StatisticPie)		{ return WF->GetIconSet()->StatisticPie; }
-	if (Icon == EIconItem::Sun) 				{ return WF->GetIconSet()->Sun; }
-	if (Icon == EIconItem::Tag) 				{ return WF->GetIconSet()->Tag; }
-	if (Icon == EIconItem::Trash)				{ return WF->GetIconSet()->Trash; }
-	if (Icon == EIconItem::Upload)				{ return WF->GetIconSet()->Upload; }
-	if (Icon == EIconItem::User)				{ return WF->GetIconSet()->User; }
-	if (Icon == EIconItem::Users)				{ return WF->GetIconSet()->Users; }
-	if (Icon == EIconItem::Video)				{ return WF->GetIconSet()->Video; }
-	if (Icon == EIconItem::Volume)				{ return WF->GetIconSet()->Volume; }
-	if (Icon == EIconItem::VolumeMinus)			{ return WF->GetIconSet()->VolumeMinus; }
-	if (Icon == EIconItem::VolumeMute) 			{ return WF->GetIconSet()->VolumeMute; }
-	if (Icon == EIconItem::VolumePlus) 			{ return WF->GetIconSet()->VolumePlus; }
-	if (Icon == EIconItem::Wifi)				{ return WF->GetIconSet()->Wifi; }
-	
-	return nullptr;
+	const UWidgetStudioSubsystem* WF = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
+	if (!WF) { return nullptr; }
+
+	return WF->GetIconTexture(Icon);
 }
 
 FFontStyle UWidgetStudioFunctionLibrary::GetTypeScaleFromTypography(const EWSFontType FontType)
@@ -165,45 +180,33 @@ FFontStyle UWidgetStudioFunctionLibrary::GetTypeScaleFromTypography(const EWSFon
 	const UWidgetStudioTypography* Typography = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>()->GetTypography();
 
 	if(!IsValid(Typography)) { return FFontStyle(); }
-	
-	if (FontType == EWSFontType::H1)				{ return Typography->H1; }
-	if (FontType == EWSFontType::H2)				{ return Typography->H2; }
-	if (FontType == EWSFontType::H3)				{ return Typography->H3; }
-	if (FontType == EWSFontType::H4)				{ return Typography->H4; }
-	if (FontType == EWSFontType::H5)				{ return Typography->H5; }
-	if (FontType == EWSFontType::H6)				{ return Typography->H6; }
-	if (FontType == EWSFontType::Subtitle1)			{ return Typography->Subtitle1; }
-	if (FontType == EWSFontType::Subtitle2)			{ return Typography->Subtitle2; }
-	if (FontType == EWSFontType::Body1)				{ return Typography->Body1; }
-	if (FontType == EWSFontType::Body2)				{ return Typography->Body2; }
-	if (FontType == EWSFontType::Button)			{ return Typography->Button; }
-	if (FontType == EWSFontType::Caption)			{ return Typography->Caption; }
-	if (FontType == EWSFontType::Overline)			{ return Typography->Overline; }
-
-	return FFontStyle();
+
+	return Typography->GetTypeScale(FontType);
 }
 
 FName UWidgetStudioFunctionLibrary::GetFontWeightName(const EFontWeight FontWeight)
 {
-	if(FontWeight == EFontWeight::Light)		{ return FName("Light"); }
-	if(FontWeight == EFontWeight::SemiLight)	{ return FName("SemiLight"); }
-	if(FontWeight == EFontWeight::Regular) 		{ return FName("Regular"); }
-	if(FontWeight == EFontWeight::SemiBold) 	{ return FName("SemiBold"); }
-	if(FontWeight == EFontWeight::Bold) 		{ return FName("Bold"); }
-	if(FontWeight == EFontWeight::Black) 		{ return FName("Black"); }
+	static const FName LightName("Light");
+	static const FName SemiLightName("SemiLight");
+	static const FName RegularName("Regular");
+	static const FName SemiBoldName("SemiBold");
+	static const FName BoldName("Bold");
+	static const FName BlackName("Black");
+	static const FName NormalName("Normal");
+
+	if(FontWeight == EFontWeight::Light)		{ return LightName; }
+	if(FontWeight == EFontWeight::SemiLight)	{ return SemiLightName; }
+	if(FontWeight == EFontWeight::Regular) 		{ return RegularName; }
+	if(FontWeight == EFontWeight::SemiBold) 	{ return SemiBoldName; }
+	if(FontWeight == EFontWeight::Bold) 		{ return BoldName; }
+	if(FontWeight == EFontWeight::Black) 		{ return BlackName; }
 
-	return FName("Normal");
+	return NormalName;
 }
 
 FVector2D UWidgetStudioFunctionLibrary::GetControlDimensions()
 {
-	const UWidgetStudioSubsystem* WidgetStudioSubsystem = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
-	if (IsValid(WidgetStudioSubsystem))
-	{
-		return WidgetStudioSubsystem->GetControlDimensions();
-	}
-	
-	return FVector2D(35, 325);
+	return UWidgetStudioSubsystem::GetControlDimensions();
 }
 
 FLinearColor UWidgetStudioFunctionLibrary::GetColorBasedValue(const float ValuePercent, const bool bReverseOrder)
@@ -315,23 +318,7 @@ void UWidgetStudioFunctionLibrary::InterpWidgetColor(UUserWidget* Widget, const
 	// Exit if the widget isn't valid.
 	if (!IsValid(Widget)) { return; }
 
-	const FLinearColor NewColor = GetColorFromPalette(TargetColor);
-
-	// Get the current color and opacity
-	FLinearColor currentColorAndOpacity = Widget->GetColorAndOpacity();
-
-	// Smoothly lerp to the new color.
-	if (currentColorAndOpacity != NewColor)
-	{
-		Widget->SetColorAndOpacity(
-			UKismetMathLibrary::CInterpTo(
-				currentColorAndOpacity,
-				NewColor,
-				Widget->GetWorld()->GetDeltaSeconds(),
-				Speed
-			)
-		);
-	}
+	FWidgetStudioTweenScheduler::Get().AnimateTo(Widget, EWSTweenProperty::WidgetColor, FVector4(GetColorFromPalette(TargetColor)), Speed);
 }
 
 
@@ -340,23 +327,7 @@ void UWidgetStudioFunctionLibrary::InterpImageColor(UImage* Widget, const EPalet
 	// Exit if the widget isn't valid.
 	if (!IsValid(Widget)) { return; }
 
-	const FLinearColor NewColor = GetColorFromPalette(TargetColor);
-
-	// Get the current color and opacity
-	FLinearColor currentColorAndOpacity = Widget->GetColorAndOpacity();
-
-	// Smoothly lerp to the new color.
-	if (currentColorAndOpacity != NewColor)
-	{
-		Widget->SetColorAndOpacity(
-			UKismetMathLibrary::CInterpTo(
-				currentColorAndOpacity,
-				NewColor,
-				Widget->GetWorld()->GetDeltaSeconds(),
-				Speed
-			)
-		);
-	}
+	FWidgetStudioTweenScheduler::Get().AnimateTo(Widget, EWSTweenProperty::ImageColor, FVector4(GetColorFromPalette(TargetColor)), Speed);
 }
 
 
@@ -365,22 +336,7 @@ void UWidgetStudioFunctionLibrary::InterpTextColor(UTextBlock* Widget, const EPa
 	// Exit if the widget isn't valid.
 	if (!IsValid(Widget)) { return; }
 
-	const FLinearColor NewColor = GetColorFromPalette(TargetColor);
-	const FLinearColor CurrentColor = Widget->GetColorAndOpacity().GetSpecifiedColor();
-
-	if (CurrentColor != NewColor)
-	{
-		Widget->SetColorAndOpacity(
-			FSlateColor(
-				UKismetMathLibrary::CInterpTo(
-					CurrentColor,
-					NewColor,
-					Widget->GetWorld()->GetDeltaSeconds(),
-					Speed
-				)
-			)
-		);
-	}
+	FWidgetStudioTweenScheduler::Get().AnimateTo(Widget, EWSTweenProperty::TextColor, FVector4(GetColorFromPalette(TargetColor)), Speed);
 }
 
 
@@ -389,21 +345,8 @@ void UWidgetStudioFunctionLibrary::InterpEditableTextBoxColor(UEditableTextBox*
 {
 	// Exit if the widget isn't valid.
 	if (!IsValid(Widget)) { return; }
-	
-	const FLinearColor NewColor = GetColorFromPalette(TargetColor);
-	const FLinearColor CurrentColor = Widget->WidgetStyle.ForegroundColor.GetSpecifiedColor();
 
-	if (CurrentColor != NewColor)
-	{
-		Widget->WidgetStyle.SetForegroundColor(
-			UKismetMathLibrary::CInterpTo(
-				CurrentColor,
-				NewColor,
-				Widget->GetWorld()->GetDeltaSeconds(),
-				Speed
-			)
-		);
-	}
+	FWidgetStudioTweenScheduler::Get().AnimateTo(Widget, EWSTweenProperty::EditableTextBoxColor, FVector4(GetColorFromPalette(TargetColor)), Speed);
 }
 
 void UWidgetStudioFunctionLibrary::InterpSizeBoxOverrides(USizeBox* Widget, const float TargetWidth, const float TargetHeight,
@@ -412,92 +355,31 @@ void UWidgetStudioFunctionLibrary::InterpSizeBoxOverrides(USizeBox* Widget, cons
 	// Exit if the widget isn't valid.
 	if (!IsValid(Widget)) { return; }
 
-	// Get the current overrides
-	float currentHeightOverride = Widget->GetHeightOverride();
-	float currentWidthOverride = Widget->GetWidthOverride();
-
-	// Smoothly lerp to the target height.
-	if (currentHeightOverride != TargetHeight && (TargetHeight != 0 || bIgnoreZero == false))
-	{
-		Widget->SetHeightOverride(
-			UKismetMathLibrary::FInterpTo(
-				currentHeightOverride,
-				TargetHeight,
-				Widget->GetWorld()->GetDeltaSeconds(),
-				Speed
-			)
-		);
-	}
+	// Zero targets leave the current override in place, unless told otherwise
+	const float Width = TargetWidth != 0 || bIgnoreZero == false ? TargetWidth : Widget->GetWidthOverride();
+	const float Height = TargetHeight != 0 || bIgnoreZero == false ? TargetHeight : Widget->GetHeightOverride();
 
-	// Smoothly lerp to the target width.
-	if (currentWidthOverride != TargetWidth && (TargetWidth != 0 || bIgnoreZero == false))
-	{
-		Widget->SetWidthOverride(
-			UKismetMathLibrary::FInterpTo(
-				currentWidthOverride,
-				TargetWidth,
-				Widget->GetWorld()->GetDeltaSeconds(),
-				Speed
-			)
-		);
-	}
+	FWidgetStudioTweenScheduler::Get().AnimateTo(Widget, EWSTweenProperty::SizeBoxOverrides, FVector4(Width, Height, 0.f, 0.f), Speed);
 }
 
-
 void UWidgetStudioFunctionLibrary::InterpSizeBoxMinOverrides(USizeBox* Widget, const float TargetWidth, const float TargetHeight, const float Speed)
 {
 	// Exit if the widget isn't valid.
 	if (!IsValid(Widget)) { return; }
 
-	// Get current values
-	float currentHeight = Widget->GetMinDesiredHeight();
-	float currentWidth = Widget->GetMinDesiredWidth();
-
-	// Smoothly lerp to the target height.
-	if (currentHeight != TargetHeight && TargetHeight != 0)
-	{
-		Widget->SetMinDesiredHeight(
-			UKismetMathLibrary::FInterpTo(
-				currentHeight,
-				TargetHeight,
-				Widget->GetWorld()->GetDeltaSeconds(),
-				Speed
-			)
-		);
-	}
+	// Zero targets leave the current value in place
+	const float Width = TargetWidth != 0 ? TargetWidth : Widget->GetMinDesiredWidth();
+	const float Height = TargetHeight != 0 ? TargetHeight : Widget->GetMinDesiredHeight();
 
-	// Smoothly lerp to the target width.
-	if (currentWidth != TargetWidth && TargetWidth != 0)
-	{
-		Widget->SetMinDesiredWidth(
-			UKismetMathLibrary::FInterpTo(
-				currentWidth,
-				TargetWidth,
-				Widget->GetWorld()->GetDeltaSeconds(),
-				Speed
-			)
-		);
-	}
+	FWidgetStudioTweenScheduler::Get().AnimateTo(Widget, EWSTweenProperty::SizeBoxMinOverrides, FVector4(Width, Height, 0.f, 0.f), Speed);
 }
 
-
 void UWidgetStudioFunctionLibrary::InterpWidgetTranslation(UWidget* Widget, const FVector2D TargetTranslation, const float Speed)
 {
 	// Exit if the widget isn't valid.
 	if (!IsValid(Widget)) { return; }
 
-	FWidgetTransform currentTransform = Widget->GetRenderTransform(); // 使用getter方法
-	if (currentTransform.Translation != TargetTranslation)
-	{
-		Widget->SetRenderTranslation(
-			UKismetMathLibrary::Vector2DInterpTo(
-				currentTransform.Translation, // Access Translation from the obtained transform
-				TargetTranslation,
-				Widget->GetWorld()->GetDeltaSeconds(),
-				Speed
-			)
-		);
-	}
+	FWidgetStudioTweenScheduler::Get().AnimateTo(Widget, EWSTweenProperty::RenderTranslation, FVector4(TargetTranslation.X, TargetTranslation.Y, 0.f, 0.f), Speed);
 }
 
 void UWidgetStudioFunctionLibrary::InterpWidgetScale(UWidget* Widget, const FVector2D TargetScale, const float Speed)
@@ -505,18 +387,7 @@ void UWidgetStudioFunctionLibrary::InterpWidgetScale(UWidget* Widget, const FVec
 	// Exit if the widget isn't valid.
 	if (!IsValid(Widget)) { return; }
 
-	FWidgetTransform currentTransform = Widget->GetRenderTransform(); // 使用getter方法
-	if (currentTransform.Scale != TargetScale)
-	{
-		Widget->SetRenderScale(
-			UKismetMathLibrary::Vector2DInterpTo(
-				currentTransform.Scale, // Access Scale from the obtained transform
-				TargetScale,
-				Widget->GetWorld()->GetDeltaSeconds(),
-				Speed
-			)
-		);
-	}
+	FWidgetStudioTweenScheduler::Get().AnimateTo(Widget, EWSTweenProperty::RenderScale, FVector4(TargetScale.X, TargetScale.Y, 0.f, 0.f), Speed);
 }
 
 
@@ -524,18 +395,8 @@ void UWidgetStudioFunctionLibrary::InterpWidgetRotation(UWidget* Widget, const f
 {
 	// Exit if the widget isn't valid.
 	if (!IsValid(Widget)) { return; }
-	
-	if (Widget->GetRenderTransformAngle() != TargetRotation)
-	{
-		Widget->SetRenderTransformAngle(
-			UKismetMathLibrary::FInterpTo(
-				Widget->GetRenderTransformAngle(),
-				TargetRotation,
-				Widget->GetWorld()->GetDeltaSeconds(),
-				Speed
-			)
-		);
-	}
+
+	FWidgetStudioTweenScheduler::Get().AnimateTo(Widget, EWSTweenProperty::RenderAngle, FVector4(TargetRotation, 0.f, 0.f, 0.f), Speed);
 }
 
 void UWidgetStudioFunctionLibrary::InterpWidgetOpacity(UWidget* Widget, const float TargetOpacity, const float Speed)
@@ -543,18 +404,7 @@ void UWidgetStudioFunctionLibrary::InterpWidgetOpacity(UWidget* Widget, const fl
 	// Exit if the widget isn't valid.
 	if (!IsValid(Widget)) { return; }
 
-	float currentOpacity = Widget->GetRenderOpacity(); // Use getter instead of direct access
-	if (currentOpacity != TargetOpacity)
-	{
-		Widget->SetRenderOpacity(
-			UKismetMathLibrary::FInterpTo(
-				currentOpacity,
-				TargetOpacity,
-				Widget->GetWorld()->GetDeltaSeconds(),
-				Speed
-			)
-		);
-	}
+	FWidgetStudioTweenScheduler::Get().AnimateTo(Widget, EWSTweenProperty::RenderOpacity, FVector4(TargetOpacity, 0.f, 0.f, 0.f), Speed);
 }
 
 
@@ -564,68 +414,109 @@ void UWidgetStudioFunctionLibrary::InterpBrushImageSize(UImage* Image, const flo
 	// Exit if the widget isn't valid.
 	if (!IsValid(Image)) { return; }
 
-	const FVector2D NewSize = FVector2D(TargetWidth, TargetHeight);
-	FSlateBrush currentBrush = Image->GetBrush(); // Use getter method
-	FVector2D currentSize = currentBrush.ImageSize; // Access ImageSize from the obtained brush
-	if (!currentSize.Equals(NewSize))
-	{
-#if ENGINE_MAJOR_VERSION == 4
-		Image->SetBrushSize(UKismetMathLibrary::Vector2DInterpTo(
-			currentSize,
-			NewSize,
-			Image->GetWorld()->GetDeltaSeconds(),
-			Speed
-		)
-		);
-#elif ENGINE_MAJOR_VERSION == 5
-		Image->SetDesiredSizeOverride(
-			UKismetMathLibrary::Vector2DInterpTo(
-				currentSize,
-				NewSize,
-				Image->GetWorld()->GetDeltaSeconds(),
-				Speed
-			)
-		);
-#endif
+	FWidgetStudioTweenScheduler::Get().AnimateTo(Image, EWSTweenProperty::BrushImageSize, FVector4(TargetWidth, TargetHeight, 0.f, 0.f), Speed);
+}
 
-		// Required for both UE4 and UE5 implementations.
-		FSlateBrush newBrush = Image->GetBrush(); // Get current brush
-		newBrush.SetImageSize(UKismetMathLibrary::Vector2DInterpTo(
-			currentSize,
-			NewSize,
-			Image->GetWorld()->GetDeltaSeconds(),
-			Speed
-		));
-		Image->SetBrush(newBrush); // Set the modified brush
-	}
+void UWidgetStudioFunctionLibrary::InterpSizeBoxOverridesWithScale(USizeBox* Widget, const float TargetWidth, const float TargetHeight, const float Speed)
+{
+	// Exit if the widget isn't valid.
+	if (!IsValid(Widget)) { return; }
+
+	const float CurrentWidth = Widget->GetWidthOverride();
+	const float CurrentHeight = Widget->GetHeightOverride();
+	const float Width = TargetWidth != 0 ? TargetWidth : CurrentWidth;
+	const float Height = TargetHeight != 0 ? TargetHeight : CurrentHeight;
+	if (CurrentWidth == Width && CurrentHeight == Height) { return; }
+
+	// Resize once, then scale from the size it is currently drawn at back to identity
+	const FVector2D CurrentScale = Widget->GetRenderTransform().Scale;
+	Widget->SetWidthOverride(Width);
+	Widget->SetHeightOverride(Height);
+
+	const FVector2D StartScale(
+		CurrentWidth > 0 && Width > 0 ? CurrentScale.X * CurrentWidth / Width : 1.f,
+		CurrentHeight > 0 && Height > 0 ? CurrentScale.Y * CurrentHeight / Height : 1.f);
+	InterpWidgetScale(Widget, StartScale, 0.f);
+	InterpWidgetScale(Widget, FVector2D(1.f, 1.f), Speed);
+}
+
+void UWidgetStudioFunctionLibrary::InterpBrushImageSizeWithScale(UImage* Image, const float TargetWidth, const float TargetHeight, const float Speed)
+{
+	// Exit if the widget isn't valid.
+	if (!IsValid(Image)) { return; }
+
+	const FVector2D CurrentSize = Image->GetBrush().ImageSize;
+	if (CurrentSize.X == TargetWidth && CurrentSize.Y == TargetHeight) { return; }
+
+	// Resize once, then scale from the size it is currently drawn at back to identity
+	const FVector2D CurrentScale = Image->GetRenderTransform().Scale;
+	SetBrushImageSize(Image, TargetWidth, TargetHeight);
+
+	const FVector2D StartScale(
+		CurrentSize.X > 0 && TargetWidth > 0 ? CurrentScale.X * CurrentSize.X / TargetWidth : 1.f,
+		CurrentSize.Y > 0 && TargetHeight > 0 ? CurrentScale.Y * CurrentSize.Y / TargetHeight : 1.f);
+	InterpWidgetScale(Image, StartScale, 0.f);
+	InterpWidgetScale(Image, FVector2D(1.f, 1.f), Speed);
 }
 
 
 UMaterialInterface* UWidgetStudioFunctionLibrary::GetRoundedBackgroundMaterial()
 {
-	const FName BackgroundMaterialPath = TEXT("/WidgetStudio/Shared/Materials/M_UI_RoundedSquare.M_UI_RoundedSquare");
-	return LoadMaterialFromPath(BackgroundMaterialPath);
+	return FWidgetStudioMaterialRegistry::Get().GetMaterial(EWSMaterial::RoundedSquare);
 }
 
 UMaterialInterface* UWidgetStudioFunctionLibrary::GetRoundedOutlineMaterial()
 {
-	const FName BackgroundMaterialPath = TEXT("/WidgetStudio/Shared/Materials/M_UI_RoundedSquare_Outline.M_UI_RoundedSquare_Outline");
-	return LoadMaterialFromPath(BackgroundMaterialPath);
+	return FWidgetStudioMaterialRegistry::Get().GetMaterial(EWSMaterial::RoundedSquareOutline);
 }
 
 UMaterialInterface* UWidgetStudioFunctionLibrary::GetRoundedShadowMaterial()
 {
-	const FName BackgroundMaterialPath = TEXT("/WidgetStudio/Shared/Materials/M_UI_RoundedDropShadow.M_UI_RoundedDropShadow");
-	return LoadMaterialFromPath(BackgroundMaterialPath);
+	return FWidgetStudioMaterialRegistry::Get().GetMaterial(EWSMaterial::RoundedDropShadow);
+}
+
+UMaterialInterface* UWidgetStudioFunctionLibrary::GetWidgetStudioMaterial(const EWSMaterial Material)
+{
+	return FWidgetStudioMaterialRegistry::Get().GetMaterial(Material);
+}
+
+UMaterialInstanceDynamic* UWidgetStudioFunctionLibrary::AcquireDynamicMaterial(const EWSMaterial Material)
+{
+	return FWidgetStudioMaterialRegistry::Get().AcquireDynamicMaterial(Material);
+}
+
+void UWidgetStudioFunctionLibrary::ReleaseDynamicMaterial(UMaterialInstanceDynamic* DynamicMaterial)
+{
+	FWidgetStudioMaterialRegistry::Get().ReleaseDynamicMaterial(DynamicMaterial);
+}
+
+int32 UWidgetStudioFunctionLibrary::GetQualityLevel()
+{
+	return FMath::Clamp(CVarWidgetStudioQuality.GetValueOnGameThread(), 0, 3);
+}
+
+bool UWidgetStudioFunctionLibrary::AreDropShadowsEnabled()
+{
+	return GetQualityTier().bDropShadows;
+}
+
+bool UWidgetStudioFunctionLibrary::AreFadesAnimated()
+{
+	return GetQualityTier().bAnimateFades;
+}
+
+bool UWidgetStudioFunctionLibrary::IsMotionAnimated()
+{
+	return GetQualityTier().bAnimateMotion;
 }
 
 UFont* UWidgetStudioFunctionLibrary::GetTypefaceFromTypography()
 {
-	const UWidgetStudioTypography* Typography = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>()->GetTypography();
+	const UWidgetStudioSubsystem* WSSubsystem = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
 
-	if (IsValid(Typography))
+	if (WSSubsystem && IsValid(WSSubsystem->GetTypeface()))
 	{
-		return Typography->Typeface;
+		return WSSubsystem->GetTypeface();
 	}
 
 	else
@@ -668,15 +559,15 @@ FText UWidgetStudioFunctionLibrary::FilterByCharacterLimit(const FText InText, c
 
 FSlateFontInfo UWidgetStudioFunctionLibrary::ConstructFontInfoFromTypography(const EWSFontType FontType)
 {
-	const FFontStyle LabelFontStyle = GetTypeScaleFromTypography(FontType);
-	
-	FSlateFontInfo LabelFontInfo;
-	LabelFontInfo.FontObject = GetTypefaceFromTypography();
-	LabelFontInfo.Size = LabelFontStyle.Size;
-	LabelFontInfo.TypefaceFontName = GetFontWeightName(LabelFontStyle.Weight);
-	LabelFontInfo.LetterSpacing = LabelFontStyle.LetterSpacing;
-	
-	return LabelFontInfo;
+	return GetFontInfoFromTypography(FontType, ESizeModifier::Regular);
+}
+
+FSlateFontInfo UWidgetStudioFunctionLibrary::GetFontInfoFromTypography(const EWSFontType FontType, const ESizeModifier Modifier)
+{
+	const UWidgetStudioSubsystem* WSSubsystem = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
+	if (!WSSubsystem) { return FSlateFontInfo(); }
+
+	return WSSubsystem->GetFontInfo(FontType, Modifier);
 }
 
 FSlateFontInfo UWidgetStudioFunctionLibrary::ConstructFontInfoFromStyle(const FFontStyle FontStyle)
@@ -692,21 +583,12 @@ FSlateFontInfo UWidgetStudioFunctionLibrary::ConstructFontInfoFromStyle(const FF
 
 float UWidgetStudioFunctionLibrary::GetSizeByModifier(const ESizeModifier Modifier, const float InSize)
 {
-	if (Modifier == ESizeModifier::Mini) { return InSize * 0.55f; }
-	if (Modifier == ESizeModifier::Tiny) { return InSize * 0.7f; }
-	if (Modifier == ESizeModifier::Small) { return InSize * 0.85f; }
-	if (Modifier == ESizeModifier::Regular) { return InSize * 1.f; }
-	if (Modifier == ESizeModifier::Large) { return InSize * 1.15f; }
-	if (Modifier == ESizeModifier::Big) { return InSize * 1.3f; }
-	if (Modifier == ESizeModifier::Huge) { return InSize * 1.45f; }
-	if (Modifier == ESizeModifier::Massive) { return InSize * 1.6f; }
-
-	return InSize;
+	return InSize * UWidgetStudioSubsystem::GetStyleConstants().GetSizeModifierScale(Modifier);
 }
 
 float UWidgetStudioFunctionLibrary::GetBorderRadius()
 {
-	return GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>()->BorderRadius;
+	return UWidgetStudioSubsystem::GetStyleConstants().BorderRadius;
 }
 
 UWidgetStudioTheme* UWidgetStudioFunctionLibrary::GetCurrentTheme()
@@ -744,3 +626,30 @@ bool UWidgetStudioFunctionLibrary::SetIconSet(const TSoftObjectPtr<UWidgetStudio
 	UWidgetStudioSubsystem* WF = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
 	return WF->SetIconSet(NewIconSet);
 }
+
+void UWidgetStudioFunctionLibrary::SetThemeAsync(UObject* WorldContextObject, const TSoftObjectPtr<UWidgetStudioTheme> NewTheme, const int32 Priority, bool& bSuccess, const FLatentActionInfo LatentInfo)
+{
+	if (const FWidgetStudioStyleLoadAction* Action = AddStyleLoadAction(WorldContextObject, LatentInfo, bSuccess))
+	{
+		UWidgetStudioSubsystem* WF = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
+		WF->RequestThemeAsync(NewTheme, Action->MakeCompletionDelegate(), Priority);
+	}
+}
+
+void UWidgetStudioFunctionLibrary::SetTypographyAsync(UObject* WorldContextObject, const TSoftObjectPtr<UWidgetStudioTypography> NewTypography, const int32 Priority, bool& bSuccess, const FLatentActionInfo LatentInfo)
+{
+	if (const FWidgetStudioStyleLoadAction* Action = AddStyleLoadAction(WorldContextObject, LatentInfo, bSuccess))
+	{
+		UWidgetStudioSubsystem* WF = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
+		WF->RequestTypographyAsync(NewTypography, Action->MakeCompletionDelegate(), Priority);
+	}
+}
+
+void UWidgetStudioFunctionLibrary::SetIconSetAsync(UObject* WorldContextObject, const TSoftObjectPtr<UWidgetStudioIconSet> NewIconSet, const int32 Priority, bool& bSuccess, const FLatentActionInfo LatentInfo)
+{
+	if (const FWidgetStudioStyleLoadAction* Action = AddStyleLoadAction(WorldContextObject, LatentInfo, bSuccess))
+	{
+		UWidgetStudioSubsystem* WF = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
+		WF->RequestIconSetAsync(NewIconSet, Action->MakeCompletionDelegate(), Priority);
+	}
+}
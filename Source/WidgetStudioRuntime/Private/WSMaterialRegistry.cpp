@@ -0,0 +1,139 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+#include "WSMaterialRegistry.h"
+#include "WidgetStudioRuntime.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/Package.h"
+
+TUniquePtr<FWidgetStudioMaterialRegistry> FWidgetStudioMaterialRegistry::Instance;
+
+static const TCHAR* GetMaterialPath(const EWSMaterial Material)
+{
+	switch (Material)
+	{
+	case EWSMaterial::RoundedSquare:			return TEXT("/WidgetStudio/Shared/Materials/M_UI_RoundedSquare.M_UI_RoundedSquare");
+	case EWSMaterial::RoundedSquareOutline:		return TEXT("/WidgetStudio/Shared/Materials/M_UI_RoundedSquare_Outline.M_UI_RoundedSquare_Outline");
+	case EWSMaterial::RoundedDropShadow:		return TEXT("/WidgetStudio/Shared/Materials/M_UI_RoundedDropShadow.M_UI_RoundedDropShadow");
+	case EWSMaterial::RoundedDropShadowOutline:	return TEXT("/WidgetStudio/Shared/Materials/M_UI_RoundedDropShadow_Outline.M_UI_RoundedDropShadow_Outline");
+	case EWSMaterial::RadialBar:				return TEXT("/WidgetStudio/Shared/Materials/M_UI_RadialBar.M_UI_RadialBar");
+	default:									return nullptr;
+	}
+}
+
+FWidgetStudioMaterialRegistry::FWidgetStudioMaterialRegistry()
+{
+	for (int32 i = 0; i < MaterialCount; i++)
+	{
+		Materials[i] = nullptr;
+	}
+}
+
+void FWidgetStudioMaterialRegistry::Initialize()
+{
+	if (Instance) return;
+
+	Instance = TUniquePtr<FWidgetStudioMaterialRegistry>(new FWidgetStudioMaterialRegistry());
+
+	// Materials can't be loaded this early in the loading phase, wait for the engine
+	Instance->PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(Instance.Get(), &FWidgetStudioMaterialRegistry::LoadMaterials);
+}
+
+void FWidgetStudioMaterialRegistry::Shutdown()
+{
+	if (!Instance) return;
+
+	FCoreDelegates::OnPostEngineInit.Remove(Instance->PostEngineInitHandle);
+	Instance.Reset();
+}
+
+FWidgetStudioMaterialRegistry& FWidgetStudioMaterialRegistry::Get()
+{
+	check(Instance);
+	return *Instance;
+}
+
+void FWidgetStudioMaterialRegistry::LoadMaterials()
+{
+	for (int32 i = 0; i < MaterialCount; i++)
+	{
+		GetMaterial(static_cast<EWSMaterial>(i));
+	}
+}
+
+UMaterialInterface* FWidgetStudioMaterialRegistry::GetMaterial(const EWSMaterial Material)
+{
+	const int32 Index = static_cast<int32>(Material);
+	if (Index >= MaterialCount) { return nullptr; }
+
+	if (!Materials[Index])
+	{
+		Materials[Index] = LoadMaterialFromPath(GetMaterialPath(Material));
+		if (!Materials[Index])
+		{
+			UE_LOG(LogWidgetStudio, Warning, TEXT("Could not load material %s."), GetMaterialPath(Material));
+		}
+	}
+
+	return Materials[Index];
+}
+
+UMaterialInstanceDynamic* FWidgetStudioMaterialRegistry::AcquireDynamicMaterial(const EWSMaterial Material)
+{
+	const int32 Index = static_cast<int32>(Material);
+	if (Index >= MaterialCount) { return nullptr; }
+
+	TArray<UMaterialInstanceDynamic*>& Pool = DynamicMaterialPools[Index];
+	while (Pool.Num() > 0)
+	{
+		UMaterialInstanceDynamic* DynamicMaterial = Pool.Pop();
+		if (IsValid(DynamicMaterial))
+		{
+			return DynamicMaterial;
+		}
+	}
+
+	UMaterialInterface* Parent = GetMaterial(Material);
+	if (!Parent) { return nullptr; }
+
+	// Pooled instances outlive the widget that requested them, so they are owned by the transient package
+	return UMaterialInstanceDynamic::Create(Parent, GetTransientPackage());
+}
+
+void FWidgetStudioMaterialRegistry::ReleaseDynamicMaterial(UMaterialInstanceDynamic* DynamicMaterial)
+{
+	if (!IsValid(DynamicMaterial)) return;
+
+	for (int32 i = 0; i < MaterialCount; i++)
+	{
+		if (Materials[i] && DynamicMaterial->Parent == Materials[i])
+		{
+			DynamicMaterial->ClearParameterValues();
+			DynamicMaterialPools[i].AddUnique(DynamicMaterial);
+			return;
+		}
+	}
+
+	UE_LOG(LogWidgetStudio, Warning, TEXT("Dynamic material %s was not created by the material registry."), *DynamicMaterial->GetName());
+}
+
+void FWidgetStudioMaterialRegistry::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (int32 i = 0; i < MaterialCount; i++)
+	{
+		Collector.AddReferencedObject(Materials[i]);
+		Collector.AddReferencedObjects(DynamicMaterialPools[i]);
+	}
+}
+
+FString FWidgetStudioMaterialRegistry::GetReferencerName() const
+{
+	return TEXT("FWidgetStudioMaterialRegistry");
+}
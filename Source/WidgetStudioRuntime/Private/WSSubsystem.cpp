@@ -1,4 +1,4 @@
-/* 
+﻿/* 
 * Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
 *
 * Website: https://widgetstudio.design
@@ -8,14 +8,36 @@
 */
 
 #include "WSSubsystem.h"
+#include "WSFunctionLibrary.h"
+#include "Engine/Font.h"
 #include "Misc/ConfigCacheIni.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Modules/ModuleManager.h"
+#include "UObject/UnrealType.h"
 #include "WSGlobals.h"
 #include "Engine/Engine.h"
+#include "Engine/StreamableManager.h"
+#include "Async/Async.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "HAL/IConsoleManager.h"
+#include "Widgets/WSBase.h"
 
 UWidgetStudioSubsystem *UWidgetStudioSubsystem::Instance = nullptr;
+FWidgetStudioStyleConstants UWidgetStudioSubsystem::StyleConstants;
+uint32 UWidgetStudioSubsystem::RestyleSerial = 0;
+
+static TAutoConsoleVariable<float> CVarWidgetStudioRestyleBudget(
+	TEXT("WidgetStudio.RestyleBudgetMs"),
+	2.f,
+	TEXT("Time in milliseconds spent per frame restyling widgets after a style change. 0 restyles every on-screen widget at once."),
+	ECVF_Default);
+
+/* Background saves of the per-user style settings -- only the most recent one is written */
+static FCriticalSection StyleSaveCriticalSection;
+static FThreadSafeCounter LatestStyleSave;
 
 
 UWidgetStudioSubsystem::UWidgetStudioSubsystem()
@@ -35,33 +57,45 @@ UWidgetStudioSubsystem::UWidgetStudioSubsystem()
 
 	//if there are values in ini file, override defaults
 	LoadValuesFromIni();
+	UpdateStyleConstants();
 
-	//initial loading of assets
+	//initial loading of assets -- fallbacks to the defaults are batched into the broadcast below
+	BeginStyleEdit();
 	LoadObject<UWidgetStudioTheme>(nullptr, *Theme.ToString());
-	if (!IsValid(Theme.Get()))
+	ActiveTheme = Theme.Get();
+	if (!IsValid(ActiveTheme))
 	{
 		const TSoftObjectPtr<UWidgetStudioTheme> DefaultThemePtr(DefaultThemePath);
 		SetTheme(DefaultThemePtr);
 	}
 
 	LoadObject<UWidgetStudioIconSet>(nullptr, *IconSet.ToString());
-	if (!IsValid(IconSet.Get()))
+	ActiveIconSet = IconSet.Get();
+	if (!IsValid(ActiveIconSet))
 	{
 		const TSoftObjectPtr<UWidgetStudioIconSet> DefaultIconSetPtr(DefaultIconSetPath);
 		SetIconSet(DefaultIconSetPtr);
 	}
 
 	LoadObject<UWidgetStudioTypography>(nullptr, *Typography.ToString());
-	if (!IsValid(Typography.Get()))
+	ActiveTypography = Typography.Get();
+	if (!IsValid(ActiveTypography))
 	{
 		const TSoftObjectPtr<UWidgetStudioTypography> DefaultTypographyPtr(DefaultTypographyPath);
 		SetTypography(DefaultTypographyPtr);
 	}
 
-	OnStyleChanged.Broadcast();
+	StyleEditDepth = 0;
+	PendingStyleChanges = EWSStyleChange::None;
+	BroadcastStyleChanged();
 
-	//save values to ini file in case any of them are missing
-	SaveValuesToIni();
+	//save values to ini file in case any of them are missing -- only the editor writes the project defaults
+#if WITH_EDITOR
+	if (GIsEditor)
+	{
+		SaveValuesToIni();
+	}
+#endif
 }
 
 UWidgetStudioSubsystem::~UWidgetStudioSubsystem()
@@ -77,271 +111,530 @@ UWidgetStudioSubsystem *UWidgetStudioSubsystem::GetInstance()
 
 UWidgetStudioTheme *UWidgetStudioSubsystem::GetTheme()
 {
-	if (!GConfig)
+	if (IsValid(ActiveTheme))
+	{
+		return ActiveTheme;
+	}
+
+	// if the active theme was never resolved or has been destroyed, set default theme
+	UE_LOG(LogWidgetStudio, Warning, TEXT("Current theme not valid.  Setting default theme."));
+	const TSoftObjectPtr<UWidgetStudioTheme> DefaultThemePtr(DefaultThemePath);
+	if (!SetTheme(DefaultThemePtr))
 	{
-		UE_LOG(LogWidgetStudio, Warning, TEXT("Could not get GConfig."));
+		UE_LOG(LogWidgetStudio, Warning, TEXT("Could not get theme."));
 		return nullptr;
 	}
 
-	UWidgetStudioTheme* ReturnTheme = nullptr;
-	const TCHAR* Section = *WSDefaultGameSection;
-	const TCHAR* Key = TEXT("Theme");
-	FString ThemeValue;
-	const FString IniFile = DefaultGameIni;
+	return ActiveTheme;
+}
 
-	if (GConfig->GetString(Section, Key, ThemeValue, IniFile))
+UWidgetStudioIconSet *UWidgetStudioSubsystem::GetIconSet()
+{
+	if (IsValid(ActiveIconSet))
 	{
-		ReturnTheme = LoadObject<UWidgetStudioTheme>(nullptr, *ThemeValue);
-		if (IsValid(ReturnTheme))
-		{
-			return ReturnTheme;
-		}
+		return ActiveIconSet;
 	}
 
-	// if ini theme is invalid or we couldn't read from ini, set default theme
-	UE_LOG(LogWidgetStudio, Warning, TEXT("Current theme not valid.  Setting default theme."));
-	ThemeValue = DefaultThemePath;
-	const FString Default = DefaultThemePath;
-	Theme = Default;
-	if (SetTheme(Theme))
+	// if the active icon set was never resolved or has been destroyed, set default icon set
+	UE_LOG(LogWidgetStudio, Warning, TEXT("Current icon set not valid.  Setting default icon set."));
+	const TSoftObjectPtr<UWidgetStudioIconSet> DefaultIconSetPtr(DefaultIconSetPath);
+	if (!SetIconSet(DefaultIconSetPtr))
 	{
-		ReturnTheme = LoadObject<UWidgetStudioTheme>(nullptr, *ThemeValue);
+		UE_LOG(LogWidgetStudio, Warning, TEXT("Could not get icon set."));
+		return nullptr;
 	}
-	else
+
+	return ActiveIconSet;
+}
+
+UWidgetStudioTypography *UWidgetStudioSubsystem::GetTypography()
+{
+	if (IsValid(ActiveTypography))
 	{
-		UE_LOG(LogWidgetStudio, Warning, TEXT("Could not set default theme."));
+		return ActiveTypography;
 	}
 
-	if (!IsValid(ReturnTheme))
+	// if the active typography was never resolved or has been destroyed, set default typography
+	UE_LOG(LogWidgetStudio, Warning, TEXT("Current typography not valid.  Setting default typography."));
+	const TSoftObjectPtr<UWidgetStudioTypography> DefaultTypographyPtr(DefaultTypographyPath);
+	if (!SetTypography(DefaultTypographyPtr))
 	{
-		UE_LOG(LogWidgetStudio, Warning, TEXT("Could not get theme."));	
+		UE_LOG(LogWidgetStudio, Warning, TEXT("Could not get typography."));
+		return nullptr;
 	}
 
-	return ReturnTheme;
+	return ActiveTypography;
 }
 
-UWidgetStudioIconSet *UWidgetStudioSubsystem::GetIconSet()
+int32 UWidgetStudioSubsystem::GetBorderRadius()
 {
-	if (!GConfig)
-	{
-		UE_LOG(LogWidgetStudio, Warning, TEXT("Could not get GConfig."));
-		return nullptr;
-	}
+	return StyleConstants.BorderRadius;
+}
 
-	UWidgetStudioIconSet* ReturnIconSet = nullptr;
-	const TCHAR* Section = *WSDefaultGameSection;
-	const TCHAR* Key = TEXT("IconSet");
-	FString IconSetValue;
-	const FString IniFile = DefaultGameIni;
+FVector2D UWidgetStudioSubsystem::GetControlDimensions()
+{
+	return FVector2D(StyleConstants.IdealWidth, StyleConstants.IdealHeight);
+}
+
+void UWidgetStudioSubsystem::GetPaletteColors(const TConstArrayView<EPalette> Colors, TArrayView<FLinearColor> OutColors) const
+{
+	check(OutColors.Num() >= Colors.Num());
 
-	if (GConfig->GetString(Section, Key, IconSetValue, IniFile))
+	for (int32 i = 0; i < Colors.Num(); i++)
 	{
-		ReturnIconSet = LoadObject<UWidgetStudioIconSet>(nullptr, *IconSetValue);
-		if (IsValid(ReturnIconSet))
-		{
-			return ReturnIconSet;
-		}
+		OutColors[i] = PaletteColors[FMath::Min(static_cast<int32>(Colors[i]), PaletteFallbackIndex)];
 	}
+}
 
-	// if ini icon set is invalid or we couldn't read from ini, set default icon set
-	UE_LOG(LogWidgetStudio, Warning, TEXT("Current icon set not valid.  Setting default icon set."));
-	IconSetValue = DefaultIconSetPath;
-	const FString Default = DefaultIconSetPath;
-	IconSet = Default;
-	if (SetIconSet(IconSet))
+void UWidgetStudioSubsystem::BroadcastStyleChanged(const EWSStyleChange StyleChanges)
+{
+	if (EnumHasAnyFlags(StyleChanges, EWSStyleChange::Palette))
 	{
-		ReturnIconSet = LoadObject<UWidgetStudioIconSet>(nullptr, *IconSetValue);
+		RebuildPaletteColors();
 	}
-	else
+	if (EnumHasAnyFlags(StyleChanges, EWSStyleChange::Typography))
 	{
-		UE_LOG(LogWidgetStudio, Warning, TEXT("Could not set default icon set."));
+		RebuildFontInfos();
 	}
-
-	if (!IsValid(ReturnIconSet))
+	if (EnumHasAnyFlags(StyleChanges, EWSStyleChange::IconSet))
 	{
-		UE_LOG(LogWidgetStudio, Warning, TEXT("Could not get icon set."));	
+		RebuildIconTextures();
 	}
 
-	return ReturnIconSet;
+	OnStyleChangedNative.Broadcast(StyleChanges);
+	OnStyleChangedWithMask.Broadcast(static_cast<int32>(StyleChanges));
+	OnStyleChanged.Broadcast();
+
+	BeginRestyle(StyleChanges);
 }
 
-UWidgetStudioTypography *UWidgetStudioSubsystem::GetTypography()
+void UWidgetStudioSubsystem::RegisterStyledWidget(UWidgetStudioBase* Widget)
 {
-	if (!GConfig)
-	{
-		UE_LOG(LogWidgetStudio, Warning, TEXT("Could not get GConfig."));
-		return nullptr;
-	}
+	if (!IsValid(Widget) || Widget->StyleRegistryIndex != INDEX_NONE) return;
+
+	// Newly constructed widgets are styled for the current style already
+	Widget->StyleRegistryIndex = StyledWidgets.Add(Widget);
+	Widget->AppliedRestyleSerial = RestyleSerial;
+	Widget->bRestyleQueued = false;
+}
 
-	UWidgetStudioTypography* ReturnTypography = nullptr;
-	const TCHAR* Section = *WSDefaultGameSection;
-	const TCHAR* Key = TEXT("Typography");
-	FString TypographyValue;
-	const FString IniFile = DefaultGameIni;
+void UWidgetStudioSubsystem::UnregisterStyledWidget(UWidgetStudioBase* Widget)
+{
+	if (!Widget || !StyledWidgets.IsValidIndex(Widget->StyleRegistryIndex)) return;
+
+	const int32 Index = Widget->StyleRegistryIndex;
+	Widget->StyleRegistryIndex = INDEX_NONE;
+	StyledWidgets.RemoveAtSwap(Index, 1, false);
 
-	if (GConfig->GetString(Section, Key, TypographyValue, IniFile))
+	// Fix up the index of the widget swapped into the freed slot
+	if (StyledWidgets.IsValidIndex(Index))
 	{
-		ReturnTypography = LoadObject<UWidgetStudioTypography>(nullptr, *TypographyValue);
-		if (IsValid(ReturnTypography))
+		if (UWidgetStudioBase* MovedWidget = StyledWidgets[Index].Get())
 		{
-			return ReturnTypography;
+			MovedWidget->StyleRegistryIndex = Index;
 		}
 	}
+}
 
-	// if ini typography is invalid or we couldn't read from ini, set default typography
-	UE_LOG(LogWidgetStudio, Warning, TEXT("Current typography not valid.  Setting default typography."));
-	TypographyValue = DefaultTypographyPath;
-	const FString Default = DefaultTypographyPath;
-	Typography = Default;
-	if (SetTypography(Typography))
-	{
-		ReturnTypography = LoadObject<UWidgetStudioTypography>(nullptr, *TypographyValue);
-	}
-	else
+void UWidgetStudioSubsystem::QueueRestyle(UWidgetStudioBase* Widget)
+{
+	if (!IsValid(Widget) || Widget->bRestyleQueued) return;
+
+	Widget->bRestyleQueued = true;
+	RestyleQueue.Add(Widget);
+	StartRestyleTicker();
+}
+
+void UWidgetStudioSubsystem::BeginRestyle(EWSStyleChange StyleChanges)
+{
+	const uint32 PreviousSerial = RestyleSerial++;
+	RestyleQueue.Reset();
+	RestyleCursor = 0;
+
+	// Only on-screen widgets are queued. Off-screen and collapsed widgets are not ticked, and queue themselves
+	// once they tick again and find their styling stale.
+	for (int32 i = StyledWidgets.Num() - 1; i >= 0; i--)
 	{
-		UE_LOG(LogWidgetStudio, Warning, TEXT("Could not set default typography."));
+		UWidgetStudioBase* Widget = StyledWidgets[i].Get();
+		if (!Widget)
+		{
+			// Drop widgets destroyed without being destructed
+			StyledWidgets.RemoveAtSwap(i, 1, false);
+			if (StyledWidgets.IsValidIndex(i) && StyledWidgets[i].IsValid())
+			{
+				StyledWidgets[i]->StyleRegistryIndex = i;
+			}
+			continue;
+		}
+
+		// Widgets that were up to date and don't use any of the changed parts stay up to date
+		if (Widget->AppliedRestyleSerial == PreviousSerial && !EnumHasAnyFlags(Widget->GetStyleDependencies(), StyleChanges))
+		{
+			Widget->AppliedRestyleSerial = RestyleSerial;
+			Widget->bRestyleQueued = false;
+			continue;
+		}
+
+		Widget->bRestyleQueued = Widget->IsOnScreen();
+		if (Widget->bRestyleQueued)
+		{
+			RestyleQueue.Add(Widget);
+		}
 	}
 
-	if (!IsValid(ReturnTypography))
+	if (RestyleQueue.Num() > 0)
 	{
-		UE_LOG(LogWidgetStudio, Warning, TEXT("Could not get typography."));	
+		StartRestyleTicker();
 	}
+}
+
+void UWidgetStudioSubsystem::StartRestyleTicker()
+{
+	if (RestyleTickerHandle.IsValid()) return;
 
-	return ReturnTypography;
+#if ENGINE_MAJOR_VERSION == 4
+	RestyleTickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UWidgetStudioSubsystem::TickRestyle));
+#else
+	RestyleTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UWidgetStudioSubsystem::TickRestyle));
+#endif
 }
 
-int32 UWidgetStudioSubsystem::GetBorderRadius()
+bool UWidgetStudioSubsystem::TickRestyle(float DeltaTime)
 {
-	const TCHAR *Section = *WSDefaultGameSection;
-	const TCHAR *Key = TEXT("BorderRadius");
-	int32 Radius;
-	const FString IniFile = DefaultGameIni;
+	const float BudgetMs = CVarWidgetStudioRestyleBudget.GetValueOnGameThread();
+	const double EndTime = FPlatformTime::Seconds() + BudgetMs * 0.001;
 
-	if (!GConfig->GetInt(Section, Key, Radius, IniFile))
+	while (RestyleCursor < RestyleQueue.Num())
 	{
-		UE_LOG(LogWidgetStudio, Warning, TEXT("Could not read border radius from .ini."));
+		UWidgetStudioBase* Widget = RestyleQueue[RestyleCursor++].Get();
+		if (!Widget) continue;
+
+		Widget->bRestyleQueued = false;
+		if (Widget->AppliedRestyleSerial != RestyleSerial)
+		{
+			Widget->AppliedRestyleSerial = RestyleSerial;
+			Widget->ForceStyleUpdate();
+		}
+
+		if (BudgetMs > 0.f && FPlatformTime::Seconds() >= EndTime) break;
 	}
 
-	return Radius;
+	OnRestyleProgress.Broadcast(RestyleCursor, RestyleQueue.Num());
+
+	if (RestyleCursor < RestyleQueue.Num()) return true;
+
+	RestyleQueue.Reset();
+	RestyleCursor = 0;
+	RestyleTickerHandle.Reset();
+	OnRestyleComplete.Broadcast();
+	return false;
 }
 
-FVector2D UWidgetStudioSubsystem::GetControlDimensions()
+void UWidgetStudioSubsystem::RebuildPaletteColors()
+{
+	// Theme colors -- blank white if theme is invalid
+	const UWidgetStudioTheme* CurrentTheme = ActiveTheme;
+	const FLinearColor White = FLinearColor(1, 1, 1, 1);
+
+	// Accent Colors
+	PaletteColors[static_cast<int32>(EPalette::PrimaryAccent)] = CurrentTheme ? CurrentTheme->PrimaryAccent : White;
+	PaletteColors[static_cast<int32>(EPalette::SecondaryAccent)] = CurrentTheme ? CurrentTheme->SecondaryAccent : White;
+
+	// Content / Foreground Colors
+	PaletteColors[static_cast<int32>(EPalette::PrimaryContent)] = CurrentTheme ? CurrentTheme->PrimaryContent : White;
+	PaletteColors[static_cast<int32>(EPalette::SecondaryContent)] = CurrentTheme ? CurrentTheme->SecondaryContent : White;
+	PaletteColors[static_cast<int32>(EPalette::TertiaryContent)] = CurrentTheme ? CurrentTheme->TertiaryContent : White;
+
+	// Background Colors
+	PaletteColors[static_cast<int32>(EPalette::PrimaryBackground)] = CurrentTheme ? CurrentTheme->PrimaryBackground : White;
+	PaletteColors[static_cast<int32>(EPalette::SecondaryBackground)] = CurrentTheme ? CurrentTheme->SecondaryBackground : White;
+	PaletteColors[static_cast<int32>(EPalette::TertiaryBackground)] = CurrentTheme ? CurrentTheme->TertiaryBackground : White;
+
+	// Basic Colors
+	PaletteColors[static_cast<int32>(EPalette::Red)]		= FLinearColor(.66, 0, .07, 1);
+	PaletteColors[static_cast<int32>(EPalette::Orange)]		= FLinearColor(.99, .32, .18, 1);
+	PaletteColors[static_cast<int32>(EPalette::Yellow)]		= FLinearColor(1, .68, 0, 1);
+	PaletteColors[static_cast<int32>(EPalette::Olive)]		= FLinearColor(.03, .61, .03, 1);
+	PaletteColors[static_cast<int32>(EPalette::Green)]		= FLinearColor(0, .32, .085, 1);
+	PaletteColors[static_cast<int32>(EPalette::Teal)]		= FLinearColor(0, .215, .215, 1);
+	PaletteColors[static_cast<int32>(EPalette::Blue)]		= FLinearColor(0, .155, .48, 1);
+	PaletteColors[static_cast<int32>(EPalette::Violet)]		= FLinearColor(.85, .22, .85, 1);
+	PaletteColors[static_cast<int32>(EPalette::Purple)]		= FLinearColor(.46, .01, .84, 1);
+	PaletteColors[static_cast<int32>(EPalette::Pink)]		= FLinearColor(1, .07, .3, 1);
+	PaletteColors[static_cast<int32>(EPalette::Brown)]		= FLinearColor(.38, .02, .02, 1);
+	PaletteColors[static_cast<int32>(EPalette::Grey)]		= FLinearColor(.35, .35, .35, 1);
+	PaletteColors[static_cast<int32>(EPalette::Black)]		= FLinearColor(0, 0, 0, 1);
+	PaletteColors[static_cast<int32>(EPalette::White)]		= FLinearColor(1, 1, 1, 1);
+	PaletteColors[static_cast<int32>(EPalette::Transparent)]	= FLinearColor(0, 0, 0, 0);
+
+	// Blank white for invalid enum values
+	PaletteColors[PaletteFallbackIndex] = White;
+}
+
+void UWidgetStudioSubsystem::RebuildFontInfos()
 {
-	FVector2D ControlDimensions;
-	if (GConfig)
+	// Resolve the typeface once, falling back to the engine default font if typography is invalid
+	const UWidgetStudioTypography* CurrentTypography = ActiveTypography;
+	ActiveTypeface = CurrentTypography ? CurrentTypography->Typeface : LoadObject<UFont>(nullptr, TEXT("/Engine/EngineFonts/Roboto.Roboto"));
+
+	for (int32 TypeIndex = 0; TypeIndex < FontTypeCount; TypeIndex++)
 	{
-		const TCHAR *KeyWidth = TEXT("IdealWidth");
-		const TCHAR *KeyHeight = TEXT("IdealHeight");
-		const TCHAR *Section = *WSDefaultGameSection;
-		float DimX, DimY;
-		const FString IniFile = DefaultGameIni;
+		const EWSFontType FontType = static_cast<EWSFontType>(TypeIndex);
+		const FFontStyle FontStyle = CurrentTypography ? CurrentTypography->GetTypeScale(FontType) : FFontStyle();
+
+		FSlateFontInfo FontInfo;
+		FontInfo.FontObject = ActiveTypeface;
+		FontInfo.TypefaceFontName = UWidgetStudioFunctionLibrary::GetFontWeightName(FontStyle.Weight);
+		FontInfo.LetterSpacing = FontStyle.LetterSpacing;
 
-		if (!GConfig->GetFloat(Section, KeyWidth, DimX, IniFile))
+		for (int32 ModifierIndex = 0; ModifierIndex < FontModifierCount; ModifierIndex++)
 		{
-			UE_LOG(LogWidgetStudio, Warning, TEXT("Could not read IdealWidth from .ini."));
+			FontInfo.Size = UWidgetStudioFunctionLibrary::GetSizeByModifier(static_cast<ESizeModifier>(ModifierIndex), FontStyle.Size);
+			FontInfos[TypeIndex * FontModifierCount + ModifierIndex] = FontInfo;
 		}
-		ControlDimensions.X = DimX;
+	}
+}
+
+void UWidgetStudioSubsystem::RebuildIconTextures()
+{
+	const UEnum* IconEnum = StaticEnum<EIconItem>();
+	const UClass* IconSetClass = UWidgetStudioIconSet::StaticClass();
+	const UWidgetStudioIconSet* CurrentIconSet = ActiveIconSet;
+
+	// Icon set properties are named after the enum entries (FName comparison ignores case, e.g. CogWheel -> Cogwheel)
+	for (int32 i = 0; i < IconTextures.Num(); i++)
+	{
+		IconTextures[i] = nullptr;
+		if (!CurrentIconSet) continue;
 
-		if (!GConfig->GetFloat(Section, KeyHeight, DimY, IniFile))
+		const FName IconName = FName(*IconEnum->GetNameStringByIndex(i));
+		const FObjectProperty* IconProperty = CastField<FObjectProperty>(IconSetClass->FindPropertyByName(IconName));
+		if (!IconProperty)
 		{
-			UE_LOG(LogWidgetStudio, Warning, TEXT("Could not read IdealHeight from .ini."));
+			UE_LOG(LogWidgetStudio, Warning, TEXT("Icon set has no texture for icon %s."), *IconName.ToString());
+			continue;
 		}
-		ControlDimensions.Y = DimY;
+
+		IconTextures[i] = Cast<UTexture2D>(IconProperty->GetObjectPropertyValue_InContainer(CurrentIconSet));
 	}
-	return ControlDimensions;
 }
 
 bool UWidgetStudioSubsystem::SetTheme(const TSoftObjectPtr<UWidgetStudioTheme> InTheme)
 {
-	LoadObject<UWidgetStudioTheme>(nullptr, *InTheme.ToString());
-	if (InTheme.IsValid())
+	UWidgetStudioTheme* LoadedTheme = InTheme.LoadSynchronous();
+	if (!IsValid(LoadedTheme))
+	{
+		UE_LOG(LogWidgetStudio, Warning, TEXT("Theme %s is invalid"), *InTheme.ToString());
+		return false;
+	}
+
+	// Newer than any async request still loading, so those are dropped once they finish
+	++PendingThemeRequest;
+	ApplyTheme(InTheme, LoadedTheme);
+	return true;
+}
+
+void UWidgetStudioSubsystem::SetThemeAsync(const TSoftObjectPtr<UWidgetStudioTheme> InTheme, const FStyleLoadDelegate& OnCompleted, const int32 Priority)
+{
+	RequestThemeAsync(InTheme, FOnStyleLoaded::CreateLambda([OnCompleted](const bool bSuccess)
+	{
+		OnCompleted.ExecuteIfBound(bSuccess);
+	}), Priority);
+}
+
+void UWidgetStudioSubsystem::RequestThemeAsync(const TSoftObjectPtr<UWidgetStudioTheme>& InTheme, FOnStyleLoaded OnCompleted, const int32 Priority)
+{
+	// Only the most recent request is applied, older ones report failure once they finish loading
+	const uint32 RequestId = ++PendingThemeRequest;
+
+	LoadStyleAssetAsync(InTheme.ToSoftObjectPath(), Priority, [this, InTheme, RequestId, OnCompleted](UObject* LoadedAsset)
 	{
-		const TSoftObjectPtr<UWidgetStudioTheme> TempTheme = Theme;
-		Theme = InTheme;
-		LoadObject<UWidgetStudioTheme>(nullptr, *Theme.ToString());
-		if (Theme.IsValid())
+		UWidgetStudioTheme* LoadedTheme = Cast<UWidgetStudioTheme>(LoadedAsset);
+		const bool bIsLatestRequest = RequestId == PendingThemeRequest;
+
+		if (!IsValid(LoadedTheme))
 		{
-			GConfig->SetString(*WSDefaultGameSection, *StringTheme, *Theme.ToString(), DefaultGameIni);
-			GConfig->Flush(false, DefaultGameIni);
-			OnStyleChanged.Broadcast();
-			return true;
+			UE_LOG(LogWidgetStudio, Warning, TEXT("Theme %s is invalid"), *InTheme.ToString());
 		}
-		else
+		else if (bIsLatestRequest)
 		{
-			Theme = TempTheme;
-			UE_LOG(LogWidgetStudio, Warning, TEXT("Could not load Theme asset"));
-			return false;
+			ApplyTheme(InTheme, LoadedTheme);
 		}
-	}
 
-	UE_LOG(LogWidgetStudio, Warning, TEXT("Theme %s is invalid"), *GetNameSafe(InTheme.Get()));
-	return false;
+		OnCompleted.ExecuteIfBound(IsValid(LoadedTheme) && bIsLatestRequest);
+	});
+}
+
+void UWidgetStudioSubsystem::ApplyTheme(const TSoftObjectPtr<UWidgetStudioTheme>& InTheme, UWidgetStudioTheme* LoadedTheme)
+{
+	Theme = InTheme;
+	ActiveTheme = LoadedTheme;
+	++StyleGeneration;
+	NotifyStyleChanged(EWSStyleChange::Palette);
 }
 
 bool UWidgetStudioSubsystem::SetIconSet(const TSoftObjectPtr<UWidgetStudioIconSet> InIconSet)
 {
-	LoadObject<UWidgetStudioIconSet>(nullptr, *InIconSet.ToString());
+	UWidgetStudioIconSet* LoadedIconSet = InIconSet.LoadSynchronous();
+	if (!IsValid(LoadedIconSet))
+	{
+		UE_LOG(LogWidgetStudio, Warning, TEXT("IconSet %s is invalid"), *InIconSet.ToString());
+		return false;
+	}
+
+	// Newer than any async request still loading, so those are dropped once they finish
+	++PendingIconSetRequest;
+	ApplyIconSet(InIconSet, LoadedIconSet);
+	return true;
+}
+
+void UWidgetStudioSubsystem::SetIconSetAsync(const TSoftObjectPtr<UWidgetStudioIconSet> InIconSet, const FStyleLoadDelegate& OnCompleted, const int32 Priority)
+{
+	RequestIconSetAsync(InIconSet, FOnStyleLoaded::CreateLambda([OnCompleted](const bool bSuccess)
+	{
+		OnCompleted.ExecuteIfBound(bSuccess);
+	}), Priority);
+}
 
-	if (InIconSet.IsValid())
+void UWidgetStudioSubsystem::RequestIconSetAsync(const TSoftObjectPtr<UWidgetStudioIconSet>& InIconSet, FOnStyleLoaded OnCompleted, const int32 Priority)
+{
+	// Only the most recent request is applied, older ones report failure once they finish loading
+	const uint32 RequestId = ++PendingIconSetRequest;
+
+	LoadStyleAssetAsync(InIconSet.ToSoftObjectPath(), Priority, [this, InIconSet, RequestId, OnCompleted](UObject* LoadedAsset)
 	{
-		const TSoftObjectPtr<UWidgetStudioIconSet> TempIconSet = IconSet;
-		IconSet = InIconSet;
-		LoadObject<UWidgetStudioIconSet>(nullptr, *IconSet.ToString());
+		UWidgetStudioIconSet* LoadedIconSet = Cast<UWidgetStudioIconSet>(LoadedAsset);
+		const bool bIsLatestRequest = RequestId == PendingIconSetRequest;
 
-		if (IconSet.IsValid())
+		if (!IsValid(LoadedIconSet))
 		{
-			GConfig->SetString(*WSDefaultGameSection, *StringIconSet, *IconSet.ToString(), DefaultGameIni);
-			GConfig->Flush(false, DefaultGameIni);
-			OnStyleChanged.Broadcast();
-			return true;
+			UE_LOG(LogWidgetStudio, Warning, TEXT("IconSet %s is invalid"), *InIconSet.ToString());
 		}
-		else
+		else if (bIsLatestRequest)
 		{
-			IconSet = TempIconSet;
-			UE_LOG(LogWidgetStudio, Warning, TEXT("Could not load IconSet asset"));
-			return false;
+			ApplyIconSet(InIconSet, LoadedIconSet);
 		}
-	}
 
-	UE_LOG(LogWidgetStudio, Warning, TEXT("IconSet %s is invalid"), *GetNameSafe(InIconSet.Get()));
-	return false;
+		OnCompleted.ExecuteIfBound(IsValid(LoadedIconSet) && bIsLatestRequest);
+	});
+}
+
+void UWidgetStudioSubsystem::ApplyIconSet(const TSoftObjectPtr<UWidgetStudioIconSet>& InIconSet, UWidgetStudioIconSet* LoadedIconSet)
+{
+	IconSet = InIconSet;
+	ActiveIconSet = LoadedIconSet;
+	++StyleGeneration;
+	NotifyStyleChanged(EWSStyleChange::IconSet);
 }
 
 bool UWidgetStudioSubsystem::SetTypography(const TSoftObjectPtr<UWidgetStudioTypography> InTypography)
 {
-	LoadObject<UWidgetStudioTypography>(nullptr, *InTypography.ToString());
+	UWidgetStudioTypography* LoadedTypography = InTypography.LoadSynchronous();
+	if (!IsValid(LoadedTypography))
+	{
+		UE_LOG(LogWidgetStudio, Warning, TEXT("Typography %s is invalid"), *InTypography.ToString());
+		return false;
+	}
+
+	// Newer than any async request still loading, so those are dropped once they finish
+	++PendingTypographyRequest;
+	ApplyTypography(InTypography, LoadedTypography);
+	return true;
+}
+
+void UWidgetStudioSubsystem::SetTypographyAsync(const TSoftObjectPtr<UWidgetStudioTypography> InTypography, const FStyleLoadDelegate& OnCompleted, const int32 Priority)
+{
+	RequestTypographyAsync(InTypography, FOnStyleLoaded::CreateLambda([OnCompleted](const bool bSuccess)
+	{
+		OnCompleted.ExecuteIfBound(bSuccess);
+	}), Priority);
+}
+
+void UWidgetStudioSubsystem::RequestTypographyAsync(const TSoftObjectPtr<UWidgetStudioTypography>& InTypography, FOnStyleLoaded OnCompleted, const int32 Priority)
+{
+	// Only the most recent request is applied, older ones report failure once they finish loading
+	const uint32 RequestId = ++PendingTypographyRequest;
 
-	if (InTypography.IsValid())
+	LoadStyleAssetAsync(InTypography.ToSoftObjectPath(), Priority, [this, InTypography, RequestId, OnCompleted](UObject* LoadedAsset)
 	{
-		const TSoftObjectPtr<UWidgetStudioTypography> TempTypography = Typography;
-		Typography = InTypography;
-		LoadObject<UWidgetStudioTypography>(nullptr, *Typography.ToString());
+		UWidgetStudioTypography* LoadedTypography = Cast<UWidgetStudioTypography>(LoadedAsset);
+		const bool bIsLatestRequest = RequestId == PendingTypographyRequest;
 
-		if (Typography.IsValid())
+		if (!IsValid(LoadedTypography))
 		{
-			GConfig->SetString(*WSDefaultGameSection, *StringTypography, *Typography.ToString(), DefaultGameIni);
-			GConfig->Flush(false, DefaultGameIni);
-			OnStyleChanged.Broadcast();
-			return true;
+			UE_LOG(LogWidgetStudio, Warning, TEXT("Typography %s is invalid"), *InTypography.ToString());
 		}
-		else
+		else if (bIsLatestRequest)
 		{
-			Typography = TempTypography;
-			UE_LOG(LogWidgetStudio, Warning, TEXT("Could not load Typography asset"));
-			return false;
+			ApplyTypography(InTypography, LoadedTypography);
 		}
+
+		OnCompleted.ExecuteIfBound(IsValid(LoadedTypography) && bIsLatestRequest);
+	});
+}
+
+void UWidgetStudioSubsystem::ApplyTypography(const TSoftObjectPtr<UWidgetStudioTypography>& InTypography, UWidgetStudioTypography* LoadedTypography)
+{
+	Typography = InTypography;
+	ActiveTypography = LoadedTypography;
+	++StyleGeneration;
+	NotifyStyleChanged(EWSStyleChange::Typography);
+}
+
+void UWidgetStudioSubsystem::PrefetchStyle(const TSoftObjectPtr<UWidgetStudioTheme> InTheme, const TSoftObjectPtr<UWidgetStudioIconSet> InIconSet,
+	const TSoftObjectPtr<UWidgetStudioTypography> InTypography, const int32 Priority)
+{
+	TArray<FSoftObjectPath> AssetPaths;
+	if (!InTheme.IsNull()) { AssetPaths.Add(InTheme.ToSoftObjectPath()); }
+	if (!InIconSet.IsNull()) { AssetPaths.Add(InIconSet.ToSoftObjectPath()); }
+	if (!InTypography.IsNull()) { AssetPaths.Add(InTypography.ToSoftObjectPath()); }
+
+	// Keep the prefetched assets resident until the next prefetch, so switching to them is instant
+	PrefetchHandle.Reset();
+	if (AssetPaths.Num() > 0)
+	{
+		PrefetchHandle = StreamableManager.RequestAsyncLoad(AssetPaths, FStreamableDelegate(), Priority);
 	}
+}
 
-	UE_LOG(LogWidgetStudio, Warning, TEXT("Typography %s is invalid"), *GetNameSafe(InTypography.Get()));
-	return false;
+void UWidgetStudioSubsystem::LoadStyleAssetAsync(const FSoftObjectPath& AssetPath, const int32 Priority, TFunction<void(UObject*)>&& OnLoaded)
+{
+	if (AssetPath.IsNull())
+	{
+		OnLoaded(nullptr);
+		return;
+	}
+
+	// Already resident, no need to go through the streamable manager
+	if (UObject* ResidentAsset = AssetPath.ResolveObject())
+	{
+		OnLoaded(ResidentAsset);
+		return;
+	}
+
+	// The asset and everything it references (e.g. icon textures) are resident when the delegate fires
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(AssetPath,
+		FStreamableDelegate::CreateWeakLambda(this, [this, AssetPath, OnLoaded = MoveTemp(OnLoaded)]()
+		{
+			PendingStyleLoads.RemoveAll([](const TSharedPtr<FStreamableHandle>& PendingLoad)
+			{
+				return !PendingLoad.IsValid() || PendingLoad->HasLoadCompleted();
+			});
+			OnLoaded(AssetPath.ResolveObject());
+		}),
+		Priority);
+
+	if (Handle.IsValid())
+	{
+		PendingStyleLoads.Add(Handle);
+	}
 }
 
 bool UWidgetStudioSubsystem::SetBorderRadius(int32 InRadius)
 {
 	BorderRadius = InRadius;
-	GConfig->SetInt(*WSDefaultGameSection, *StringBorderRadius, BorderRadius, DefaultGameIni);
-	GConfig->Flush(false, DefaultGameIni);
-	OnStyleChanged.Broadcast();
+	UpdateStyleConstants();
+	NotifyStyleChanged(EWSStyleChange::BorderRadius);
 	return true;
 	//should return false if write fails
 }
@@ -350,14 +643,99 @@ bool UWidgetStudioSubsystem::SetControlDimensions(const FVector2D InDimensions)
 {
 	IdealWidth = InDimensions.X;
 	IdealHeight = InDimensions.Y;
-	GConfig->SetFloat(*WSDefaultGameSection, *StringIdealWidth, IdealWidth, DefaultGameIni);
-	GConfig->SetFloat(*WSDefaultGameSection, *StringIdealHeight, IdealHeight, DefaultGameIni);
-	GConfig->Flush(false, DefaultGameIni);
-	OnStyleChanged.Broadcast();
+	UpdateStyleConstants();
+	NotifyStyleChanged(EWSStyleChange::Dimensions);
 	return true;
 	//should return false if write fails
 }
 
+void UWidgetStudioSubsystem::BeginStyleEdit()
+{
+	StyleEditDepth++;
+}
+
+void UWidgetStudioSubsystem::CommitStyleEdit()
+{
+	if (StyleEditDepth <= 0)
+	{
+		UE_LOG(LogWidgetStudio, Warning, TEXT("CommitStyleEdit called without a matching BeginStyleEdit."));
+		return;
+	}
+
+	StyleEditDepth--;
+	if (StyleEditDepth == 0 && PendingStyleChanges != EWSStyleChange::None)
+	{
+		const EWSStyleChange StyleChanges = PendingStyleChanges;
+		PendingStyleChanges = EWSStyleChange::None;
+		BroadcastStyleChanged(StyleChanges);
+		SaveStyleSettings();
+	}
+}
+
+void UWidgetStudioSubsystem::NotifyStyleChanged(const EWSStyleChange StyleChanges)
+{
+	// Defer to CommitStyleEdit while a style edit is open
+	if (StyleEditDepth > 0)
+	{
+		PendingStyleChanges |= StyleChanges;
+		return;
+	}
+
+	BroadcastStyleChanged(StyleChanges);
+	SaveStyleSettings();
+}
+
+void UWidgetStudioSubsystem::SaveStyleSettings() const
+{
+#if WITH_EDITOR
+	// In the editor the settings are the project defaults
+	if (GIsEditor)
+	{
+		SaveValuesToIni();
+		GConfig->Flush(false, DefaultGameIni);
+		return;
+	}
+#endif
+
+	// Otherwise they are the player's own settings, written from a background task so the game thread never waits on disk
+	FString Contents = FString::Printf(TEXT("[%s]\r\n"), *WSDefaultGameSection);
+	Contents += FString::Printf(TEXT("%s=%s\r\n"), *StringTheme, *Theme.ToString());
+	Contents += FString::Printf(TEXT("%s=%s\r\n"), *StringIconSet, *IconSet.ToString());
+	Contents += FString::Printf(TEXT("%s=%s\r\n"), *StringTypography, *Typography.ToString());
+	Contents += FString::Printf(TEXT("%s=%d\r\n"), *StringBorderRadius, BorderRadius);
+	Contents += FString::Printf(TEXT("%s=%s\r\n"), *StringIdealWidth, *FString::SanitizeFloat(IdealWidth));
+	Contents += FString::Printf(TEXT("%s=%s\r\n"), *StringIdealHeight, *FString::SanitizeFloat(IdealHeight));
+
+	const FString Path = GetUserSettingsPath();
+	const int32 SaveId = LatestStyleSave.Increment();
+
+	// An older save either wrote before the latest one got the lock or skips once it gets it, so waiting on the latest is enough
+	StyleSaveTask = Async(EAsyncExecution::ThreadPool, [Contents = MoveTemp(Contents), Path, SaveId]()
+	{
+		FScopeLock Lock(&StyleSaveCriticalSection);
+
+		// A newer save has been issued, skip this one
+		if (SaveId != LatestStyleSave.GetValue()) return;
+
+		if (!FFileHelper::SaveStringToFile(Contents, *Path))
+		{
+			UE_LOG(LogWidgetStudio, Warning, TEXT("Could not save style settings to %s."), *Path);
+		}
+	});
+}
+
+FString UWidgetStudioSubsystem::GetUserSettingsPath()
+{
+	return FPaths::Combine(FPaths::GeneratedConfigDir(), TEXT("WidgetStudio.ini"));
+}
+
+void UWidgetStudioSubsystem::UpdateStyleConstants()
+{
+	StyleConstants.BorderRadius = BorderRadius;
+	StyleConstants.IdealWidth = IdealWidth;
+	StyleConstants.IdealHeight = IdealHeight;
+}
+
 void UWidgetStudioSubsystem::LoadValuesFromIni()
 {
 	FString ReadString;
@@ -377,6 +755,39 @@ void UWidgetStudioSubsystem::LoadValuesFromIni()
 	GConfig->GetInt(*WSDefaultGameSection, *StringBorderRadius, BorderRadius, DefaultGameIni);
 	GConfig->GetFloat(*WSDefaultGameSection, *StringIdealWidth, IdealWidth, DefaultGameIni);
 	GConfig->GetFloat(*WSDefaultGameSection, *StringIdealHeight, IdealHeight, DefaultGameIni);
+
+#if WITH_EDITOR
+	if (GIsEditor) return;
+#endif
+
+	// Outside of the editor, settings saved by the player override the project defaults
+	FConfigFile UserSettings;
+	UserSettings.Read(GetUserSettingsPath());
+
+	if (UserSettings.GetString(*WSDefaultGameSection, *StringTheme, ReadString))
+	{
+		Theme = ReadString;
+	}
+	if (UserSettings.GetString(*WSDefaultGameSection, *StringIconSet, ReadString))
+	{
+		IconSet = ReadString;
+	}
+	if (UserSettings.GetString(*WSDefaultGameSection, *StringTypography, ReadString))
+	{
+		Typography = ReadString;
+	}
+	if (UserSettings.GetString(*WSDefaultGameSection, *StringBorderRadius, ReadString))
+	{
+		BorderRadius = FCString::Atoi(*ReadString);
+	}
+	if (UserSettings.GetString(*WSDefaultGameSection, *StringIdealWidth, ReadString))
+	{
+		IdealWidth = FCString::Atof(*ReadString);
+	}
+	if (UserSettings.GetString(*WSDefaultGameSection, *StringIdealHeight, ReadString))
+	{
+		IdealHeight = FCString::Atof(*ReadString);
+	}
 }
 
 void UWidgetStudioSubsystem::SaveValuesToIni() const
@@ -477,4 +888,19 @@ void UWidgetStudioSubsystem::Initialize(FSubsystemCollectionBase &Collection)
 
 void UWidgetStudioSubsystem::Deinitialize()
 {
+	if (RestyleTickerHandle.IsValid())
+	{
+#if ENGINE_MAJOR_VERSION == 4
+		FTicker::GetCoreTicker().RemoveTicker(RestyleTickerHandle);
+#else
+		FTSTicker::GetCoreTicker().RemoveTicker(RestyleTickerHandle);
+#endif
+		RestyleTickerHandle.Reset();
+	}
+
+	// Don't let a save still in flight be cut off by the shutdown
+	if (StyleSaveTask.IsValid())
+	{
+		StyleSaveTask.Wait();
+	}
 }
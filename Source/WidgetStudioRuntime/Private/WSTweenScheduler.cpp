@@ -0,0 +1,616 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+
+#include "WSTweenScheduler.h"
+#include "WidgetStudioRuntime.h"
+#include "WSAnimationClock.h"
+#include "WSFunctionLibrary.h"
+#include "Widgets/WSBase.h"
+#include "Blueprint/UserWidget.h"
+#include "Components/EditableTextBox.h"
+#include "Components/Image.h"
+#include "Components/SizeBox.h"
+#include "Components/TextBlock.h"
+#include "Math/VectorRegister.h"
+
+TUniquePtr<FWidgetStudioTweenScheduler> FWidgetStudioTweenScheduler::Instance;
+float FWidgetStudioTweenScheduler::EasingTables[static_cast<int32>(EWSEasing::Easing_Max)][EasingTableSize + 1];
+
+/* A step long enough to finish any tween */
+static constexpr float SnapStepTime = MAX_flt;
+
+DECLARE_STATS_GROUP(TEXT("WidgetStudio"), STATGROUP_WidgetStudio, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Tick Tweens"), STAT_WidgetStudioTickTweens, STATGROUP_WidgetStudio);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Active Tweens"), STAT_WidgetStudioActiveTweens, STATGROUP_WidgetStudio);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Over Budget Tweens"), STAT_WidgetStudioOverBudgetTweens, STATGROUP_WidgetStudio);
+
+static TAutoConsoleVariable<int32> CVarWidgetStudioAnimationBudget(
+	TEXT("WidgetStudio.AnimationBudget"),
+	0,
+	TEXT("Number of tweens advanced at full rate per frame. Tweens of hovered, focused and pressed widgets always are, ")
+	TEXT("the others beyond the budget are degraded as set by WidgetStudio.AnimationOverBudgetMode. 0 disables the budget."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarWidgetStudioAnimationOverBudgetMode(
+	TEXT("WidgetStudio.AnimationOverBudgetMode"),
+	1,
+	TEXT("How tweens beyond WidgetStudio.AnimationBudget are degraded.\n")
+	TEXT(" 0: snap to their target\n")
+	TEXT(" 1: advance every WidgetStudio.AnimationThrottleInterval frames"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarWidgetStudioAnimationThrottleInterval(
+	TEXT("WidgetStudio.AnimationThrottleInterval"),
+	4,
+	TEXT("Frames between two updates of a tween beyond WidgetStudio.AnimationBudget when throttling."),
+	ECVF_Default);
+
+static FAutoConsoleCommand CmdWidgetStudioAnimationBudgetStats(
+	TEXT("WidgetStudio.AnimationBudgetStats"),
+	TEXT("Log how often the animation budget was exceeded since the last call, then reset the counters."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FWidgetStudioTweenScheduler& Scheduler = FWidgetStudioTweenScheduler::Get();
+		const FWidgetStudioTweenScheduler::FBudgetStats& Stats = Scheduler.GetBudgetStats();
+		UE_LOG(LogWidgetStudio, Display, TEXT("Animation budget exceeded on %u frames, %u tweens snapped, %u tween updates throttled."),
+			Stats.FramesOverBudget, Stats.SnappedTweens, Stats.ThrottledTweens);
+		Scheduler.ResetBudgetStats();
+	}));
+
+#if ENGINE_MAJOR_VERSION == 4
+typedef VectorRegister FTweenRegister;
+#else
+typedef VectorRegister4Float FTweenRegister;
+#endif
+
+void FWidgetStudioTweenScheduler::Initialize()
+{
+	if (Instance) return;
+
+	BuildEasingTables();
+	Instance = TUniquePtr<FWidgetStudioTweenScheduler>(new FWidgetStudioTweenScheduler());
+}
+
+void FWidgetStudioTweenScheduler::Shutdown()
+{
+	Instance.Reset();
+}
+
+FWidgetStudioTweenScheduler& FWidgetStudioTweenScheduler::Get()
+{
+	check(Instance);
+	return *Instance;
+}
+
+FWidgetStudioTweenScheduler::~FWidgetStudioTweenScheduler()
+{
+	if (ClockHandle.IsValid())
+	{
+		FWidgetStudioAnimationClock::Get().RemoveListener(ClockHandle);
+	}
+}
+
+void FWidgetStudioTweenScheduler::AnimateTo(UWidget* Widget, const EWSTweenProperty Property, const FVector4& TargetValue, float Speed)
+{
+	if (!IsValid(Widget)) { return; }
+
+	// Properties the quality level does not animate go straight to their target
+	if (!(IsFade(Property) ? UWidgetStudioFunctionLibrary::AreFadesAnimated() : UWidgetStudioFunctionLibrary::IsMotionAnimated()))
+	{
+		Speed = 0.f;
+	}
+
+	const FTweenKey Key = { Widget, Property };
+	const int32* ExistingIndex = TweenIndices.Find(Key);
+
+	// Widget Studio widgets following an easing curve animate over their duration, scaled like their animation speed
+	UWidgetStudioBase* Owner = Widget->GetTypedOuter<UWidgetStudioBase>();
+	EWSEasing Easing = EWSEasing::Exponential;
+	float Duration = 0.f;
+	if (Owner && Owner->Easing != EWSEasing::Exponential && Owner->Easing < EWSEasing::Easing_Max && Speed > 0.f)
+	{
+		Easing = Owner->Easing;
+		Duration = Owner->AnimationDuration * Owner->AnimationTime / Speed;
+	}
+
+	// Snap, dropping any running tween
+	if (Speed <= 0.f || (Easing != EWSEasing::Exponential && Duration <= 0.f))
+	{
+		if (ExistingIndex)
+		{
+			RemoveTween(*ExistingIndex);
+			BroadcastSettledOwners();
+		}
+		if (ReadProperty(Widget, Property) != TargetValue)
+		{
+			WriteProperty(Widget, Property, TargetValue);
+		}
+		return;
+	}
+
+	// Retarget the running tween
+	if (ExistingIndex)
+	{
+		const int32 Index = *ExistingIndex;
+		Speeds[Index] = Speed;
+
+		// Widgets set the same target every frame, only a new one restarts the tween
+		float* Target = &TargetValues[Index * 4];
+		if (Target[0] == TargetValue.X && Target[1] == TargetValue.Y && Target[2] == TargetValue.Z && Target[3] == TargetValue.W
+			&& Tweens[Index].Easing == Easing)
+		{
+			return;
+		}
+
+		Target[0] = TargetValue.X;
+		Target[1] = TargetValue.Y;
+		Target[2] = TargetValue.Z;
+		Target[3] = TargetValue.W;
+		FMemory::Memcpy(&StartValues[Index * 4], &CurrentValues[Index * 4], 4 * sizeof(float));
+
+		NumTimedTweens += (Duration > 0.f) - (Durations[Index] > 0.f);
+		Tweens[Index].Easing = Easing;
+		Durations[Index] = Duration;
+		Elapsed[Index] = 0.f;
+		return;
+	}
+
+	// Already settled, snap away any leftover difference
+	const FVector4 Current = ReadProperty(Widget, Property);
+	const float Epsilon = GetSettleEpsilon(Property);
+	const FVector4 Distance = TargetValue - Current;
+	if (FMath::Abs(Distance.X) <= Epsilon && FMath::Abs(Distance.Y) <= Epsilon && FMath::Abs(Distance.Z) <= Epsilon && FMath::Abs(Distance.W) <= Epsilon)
+	{
+		if (Current != TargetValue)
+		{
+			WriteProperty(Widget, Property, TargetValue);
+		}
+		return;
+	}
+
+	// Widgets that are not on screen go straight to their target, nobody would see the animation
+	if (Owner && !Owner->IsOnScreen())
+	{
+		WriteProperty(Widget, Property, TargetValue);
+		return;
+	}
+
+	TweenIndices.Add(Key, Tweens.Num());
+	Tweens.Add({ Key, Widget, Owner, Easing });
+	CurrentValues.Append({ static_cast<float>(Current.X), static_cast<float>(Current.Y), static_cast<float>(Current.Z), static_cast<float>(Current.W) });
+	StartValues.Append({ static_cast<float>(Current.X), static_cast<float>(Current.Y), static_cast<float>(Current.Z), static_cast<float>(Current.W) });
+	TargetValues.Append({ static_cast<float>(TargetValue.X), static_cast<float>(TargetValue.Y), static_cast<float>(TargetValue.Z), static_cast<float>(TargetValue.W) });
+	Speeds.Add(Speed);
+	Epsilons.Add(Epsilon);
+	Durations.Add(Duration);
+	Elapsed.Add(0.f);
+	NumTimedTweens += Duration > 0.f;
+
+	if (Owner && Owner->ActiveTweenCount++ == 0)
+	{
+		Owner->OnAnimationStarted.Broadcast(Owner);
+	}
+
+	if (!ClockHandle.IsValid())
+	{
+		ClockHandle = FWidgetStudioAnimationClock::Get().AddListener(FOnWidgetStudioAnimationClockTick::FDelegate::CreateRaw(this, &FWidgetStudioTweenScheduler::Tick));
+	}
+}
+
+float FWidgetStudioTweenScheduler::EvaluateEasing(const EWSEasing Easing, const float Time)
+{
+	if (Easing == EWSEasing::Exponential || Easing >= EWSEasing::Easing_Max)
+	{
+		return FMath::Clamp(Time, 0.f, 1.f);
+	}
+
+	const float* Table = EasingTables[static_cast<int32>(Easing)];
+	const float Position = FMath::Clamp(Time, 0.f, 1.f) * EasingTableSize;
+	const int32 Sample = FMath::Min(FMath::FloorToInt(Position), EasingTableSize - 1);
+	return FMath::Lerp(Table[Sample], Table[Sample + 1], Position - Sample);
+}
+
+void FWidgetStudioTweenScheduler::BuildEasingTables()
+{
+	// All curves ease out, starting fast and slowing into the target
+	for (int32 Sample = 0; Sample <= EasingTableSize; Sample++)
+	{
+		const float Time = static_cast<float>(Sample) / EasingTableSize;
+		const float Remaining = 1.f - Time;
+
+		EasingTables[static_cast<int32>(EWSEasing::Exponential)][Sample] = Time;
+		EasingTables[static_cast<int32>(EWSEasing::Linear)][Sample] = Time;
+		EasingTables[static_cast<int32>(EWSEasing::Cubic)][Sample] = 1.f - FMath::Pow(Remaining, 3.f);
+		EasingTables[static_cast<int32>(EWSEasing::Quint)][Sample] = 1.f - FMath::Pow(Remaining, 5.f);
+
+		// Overshoots the target by 10% before settling back
+		const float Overshoot = 1.70158f;
+		EasingTables[static_cast<int32>(EWSEasing::Back)][Sample] = 1.f - (Overshoot + 1.f) * FMath::Pow(Remaining, 3.f) + Overshoot * FMath::Pow(Remaining, 2.f);
+
+		// Damped oscillation around the target, crossing it for the last time at the end of the duration
+		EasingTables[static_cast<int32>(EWSEasing::Spring)][Sample] = 1.f - FMath::Exp(-7.f * Time) * FMath::Cos(4.5f * PI * Time);
+	}
+
+	// Every curve lands exactly on its target
+	for (int32 Easing = 0; Easing < static_cast<int32>(EWSEasing::Easing_Max); Easing++)
+	{
+		EasingTables[Easing][0] = 0.f;
+		EasingTables[Easing][EasingTableSize] = 1.f;
+	}
+}
+
+void FWidgetStudioTweenScheduler::AdvanceTweens(float* RESTRICT Current, float* RESTRICT Start, const float* RESTRICT Target, const float* RESTRICT Weights,
+	const float* RESTRICT Epsilons, const float* RESTRICT Durations, const int32 NumTweens)
+{
+	// One tween per vector register. Exponential tweens restart from their current value every step, the same approach
+	// as CInterpTo / FInterpTo, while timed tweens always blend from the value they started at.
+	for (int32 i = 0; i < NumTweens; i++)
+	{
+		const FTweenRegister StartValue = VectorLoadAligned(Start + i * 4);
+		const FTweenRegister TargetValue = VectorLoadAligned(Target + i * 4);
+		const FTweenRegister Distance = VectorSubtract(TargetValue, StartValue);
+		const FTweenRegister NewValue = VectorMultiplyAdd(Distance, VectorLoadFloat1(Weights + i), StartValue);
+
+		// Exponential tweens snap each channel to the target once the step left is within the settle epsilon, timed
+		// tweens follow their curve through any overshoot
+		const FTweenRegister TimedMask = VectorCompareGT(VectorLoadFloat1(Durations + i), VectorZero());
+		const FTweenRegister MovingMask = VectorBitwiseOr(TimedMask, VectorCompareGT(VectorAbs(VectorSubtract(TargetValue, NewValue)), VectorLoadFloat1(Epsilons + i)));
+		const FTweenRegister Result = VectorSelect(MovingMask, NewValue, TargetValue);
+
+		VectorStoreAligned(Result, Current + i * 4);
+		VectorStoreAligned(VectorSelect(TimedMask, StartValue, Result), Start + i * 4);
+	}
+}
+
+void FWidgetStudioTweenScheduler::Tick(const float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_WidgetStudioTickTweens);
+
+	const int32 NumTweens = Tweens.Num();
+	TickCount++;
+	SET_DWORD_STAT(STAT_WidgetStudioActiveTweens, NumTweens);
+
+	// Time every tween steps forward this frame
+	StepTimes.Init(DeltaTime, NumTweens);
+
+	const int32 Budget = CVarWidgetStudioAnimationBudget.GetValueOnGameThread();
+	if (Budget > 0 && NumTweens > Budget)
+	{
+		ApplyBudget(Budget);
+	}
+	else
+	{
+		SET_DWORD_STAT(STAT_WidgetStudioOverBudgetTweens, 0);
+	}
+
+	// Snap the tweens of widgets that were culled, collapsed or scrolled out of view -- they are no longer ticked
+	for (int32 Index = 0; Index < NumTweens; Index++)
+	{
+		const UWidgetStudioBase* Owner = Tweens[Index].Owner.Get();
+		if (Owner && !Owner->IsOnScreen())
+		{
+			StepTimes[Index] = SnapStepTime;
+		}
+	}
+
+	// Weight of every exponential tween, four at a time
+	Weights.SetNumUninitialized(NumTweens, false);
+	const FTweenRegister Zero = VectorSetFloat1(0.f);
+	const FTweenRegister One = VectorSetFloat1(1.f);
+
+	int32 i = 0;
+	for (; i + 4 <= NumTweens; i += 4)
+	{
+		const FTweenRegister Weight = VectorMin(VectorMax(VectorMultiply(VectorLoad(Speeds.GetData() + i), VectorLoad(StepTimes.GetData() + i)), Zero), One);
+		VectorStore(Weight, Weights.GetData() + i);
+	}
+	for (; i < NumTweens; i++)
+	{
+		Weights[i] = FMath::Clamp(StepTimes[i] * Speeds[i], 0.f, 1.f);
+	}
+
+	// Timed tweens read their weight from their easing curve instead
+	if (NumTimedTweens > 0)
+	{
+		for (int32 Index = 0; Index < NumTweens; Index++)
+		{
+			if (Durations[Index] <= 0.f) { continue; }
+
+			Elapsed[Index] = FMath::Min(Elapsed[Index] + StepTimes[Index], Durations[Index]);
+			if (Elapsed[Index] < Durations[Index])
+			{
+				Weights[Index] = EvaluateEasing(Tweens[Index].Easing, Elapsed[Index] / Durations[Index]);
+			}
+			else
+			{
+				// Land exactly on the target at the end of the duration
+				FMemory::Memcpy(&StartValues[Index * 4], &TargetValues[Index * 4], 4 * sizeof(float));
+				Weights[Index] = 0.f;
+			}
+		}
+	}
+
+	AdvanceTweens(CurrentValues.GetData(), StartValues.GetData(), TargetValues.GetData(), Weights.GetData(), Epsilons.GetData(), Durations.GetData(), NumTweens);
+
+	// Scatter the results back to the widgets, iterating backwards so finished tweens can be removed in place
+	for (int32 Index = NumTweens - 1; Index >= 0; Index--)
+	{
+		UWidget* Widget = Tweens[Index].Widget.Get();
+		if (!Widget)
+		{
+			RemoveTween(Index);
+			continue;
+		}
+
+		// Throttled tweens did not move this frame
+		const float* Current = &CurrentValues[Index * 4];
+		if (StepTimes[Index] > 0.f)
+		{
+			WriteProperty(Widget, Tweens[Index].Key.Property, FVector4(Current[0], Current[1], Current[2], Current[3]));
+		}
+
+		const FTweenRegister Settled = VectorCompareEQ(VectorLoadAligned(Current), VectorLoadAligned(&TargetValues[Index * 4]));
+		if (VectorMaskBits(Settled) == 0xF && Elapsed[Index] >= Durations[Index])
+		{
+			RemoveTween(Index);
+		}
+	}
+
+	BroadcastSettledOwners();
+
+	if (Tweens.Num() > 0) return;
+
+	FWidgetStudioAnimationClock::Get().RemoveListener(ClockHandle);
+	ClockHandle.Reset();
+}
+
+void FWidgetStudioTweenScheduler::ApplyBudget(const int32 Budget)
+{
+	const int32 NumTweens = Tweens.Num();
+	BudgetStats.FramesOverBudget++;
+	SET_DWORD_STAT(STAT_WidgetStudioOverBudgetTweens, NumTweens - Budget);
+
+	// Tweens of widgets the user is interacting with keep their full rate, even past the budget
+	int32 RemainingBudget = Budget;
+	FullRateTweens.Init(false, NumTweens);
+	for (int32 Index = 0; Index < NumTweens; Index++)
+	{
+		const UWidgetStudioBase* Owner = Tweens[Index].Owner.Get();
+		if (Owner && Owner->HasAnimationPriority())
+		{
+			FullRateTweens[Index] = true;
+			RemainingBudget--;
+		}
+	}
+
+	const bool bSnap = CVarWidgetStudioAnimationOverBudgetMode.GetValueOnGameThread() == 0;
+	const int32 Interval = FMath::Max(CVarWidgetStudioAnimationThrottleInterval.GetValueOnGameThread(), 1);
+
+	for (int32 Index = 0; Index < NumTweens; Index++)
+	{
+		if (FullRateTweens[Index]) { continue; }
+
+		if (RemainingBudget > 0)
+		{
+			RemainingBudget--;
+			continue;
+		}
+
+		if (bSnap)
+		{
+			StepTimes[Index] = SnapStepTime;
+			BudgetStats.SnappedTweens++;
+		}
+		// Throttled tweens catch up on the skipped frames, staggered so each frame advances a share of them
+		else if ((TickCount + Index) % Interval == 0)
+		{
+			StepTimes[Index] *= Interval;
+		}
+		else
+		{
+			StepTimes[Index] = 0.f;
+			BudgetStats.ThrottledTweens++;
+		}
+	}
+}
+
+void FWidgetStudioTweenScheduler::RemoveTween(const int32 Index)
+{
+	const FTweenInfo& Tween = Tweens[Index];
+	TweenIndices.Remove(Tween.Key);
+
+	if (UWidgetStudioBase* Owner = Tween.Owner.Get())
+	{
+		if (--Owner->ActiveTweenCount == 0)
+		{
+			SettledOwners.Add(Owner);
+		}
+	}
+
+	NumTimedTweens -= Durations[Index] > 0.f;
+
+	const int32 LastIndex = Tweens.Num() - 1;
+	if (Index != LastIndex)
+	{
+		FMemory::Memcpy(&CurrentValues[Index * 4], &CurrentValues[LastIndex * 4], 4 * sizeof(float));
+		FMemory::Memcpy(&StartValues[Index * 4], &StartValues[LastIndex * 4], 4 * sizeof(float));
+		FMemory::Memcpy(&TargetValues[Index * 4], &TargetValues[LastIndex * 4], 4 * sizeof(float));
+	}
+	CurrentValues.SetNum(LastIndex * 4, false);
+	StartValues.SetNum(LastIndex * 4, false);
+	TargetValues.SetNum(LastIndex * 4, false);
+	Speeds.RemoveAtSwap(Index, 1, false);
+	Epsilons.RemoveAtSwap(Index, 1, false);
+	Durations.RemoveAtSwap(Index, 1, false);
+	Elapsed.RemoveAtSwap(Index, 1, false);
+
+	Tweens.RemoveAtSwap(Index, 1, false);
+	if (Tweens.IsValidIndex(Index))
+	{
+		const FTweenInfo& MovedTween = Tweens[Index];
+		TweenIndices.Add(MovedTween.Key, Index);
+	}
+}
+
+void FWidgetStudioTweenScheduler::BroadcastSettledOwners()
+{
+	if (SettledOwners.Num() == 0) { return; }
+
+	// Handlers may start new tweens, so broadcast from a copy
+	TArray<TWeakObjectPtr<UWidgetStudioBase>> Owners = MoveTemp(SettledOwners);
+	SettledOwners.Reset();
+
+	for (const TWeakObjectPtr<UWidgetStudioBase>& OwnerPtr : Owners)
+	{
+		UWidgetStudioBase* Owner = OwnerPtr.Get();
+		if (Owner && Owner->ActiveTweenCount == 0)
+		{
+			Owner->OnAnimationSettled.Broadcast(Owner);
+		}
+	}
+}
+
+bool FWidgetStudioTweenScheduler::IsFade(const EWSTweenProperty Property)
+{
+	switch (Property)
+	{
+	case EWSTweenProperty::WidgetColor:
+	case EWSTweenProperty::ImageColor:
+	case EWSTweenProperty::TextColor:
+	case EWSTweenProperty::EditableTextBoxColor:
+	case EWSTweenProperty::RenderOpacity:
+		return true;
+	default:
+		return false;
+	}
+}
+
+float FWidgetStudioTweenScheduler::GetSettleEpsilon(const EWSTweenProperty Property)
+{
+	switch (Property)
+	{
+	case EWSTweenProperty::WidgetColor:
+	case EWSTweenProperty::ImageColor:
+	case EWSTweenProperty::TextColor:
+	case EWSTweenProperty::EditableTextBoxColor:
+	case EWSTweenProperty::RenderOpacity:
+		return 0.5f / 255.f;
+	case EWSTweenProperty::SizeBoxOverrides:
+	case EWSTweenProperty::SizeBoxMinOverrides:
+	case EWSTweenProperty::RenderTranslation:
+	case EWSTweenProperty::BrushImageSize:
+		return 0.1f;
+	case EWSTweenProperty::RenderScale:
+		return 0.001f;
+	case EWSTweenProperty::RenderAngle:
+		return 0.05f;
+	default:
+		return KINDA_SMALL_NUMBER;
+	}
+}
+
+FVector4 FWidgetStudioTweenScheduler::ReadProperty(const UWidget* Widget, const EWSTweenProperty Property)
+{
+	switch (Property)
+	{
+	case EWSTweenProperty::WidgetColor:
+		return FVector4(CastChecked<UUserWidget>(Widget)->GetColorAndOpacity());
+	case EWSTweenProperty::ImageColor:
+		return FVector4(CastChecked<UImage>(Widget)->GetColorAndOpacity());
+	case EWSTweenProperty::TextColor:
+		return FVector4(CastChecked<UTextBlock>(Widget)->GetColorAndOpacity().GetSpecifiedColor());
+	case EWSTweenProperty::EditableTextBoxColor:
+		return FVector4(CastChecked<UEditableTextBox>(Widget)->WidgetStyle.ForegroundColor.GetSpecifiedColor());
+	case EWSTweenProperty::SizeBoxOverrides:
+	{
+		const USizeBox* SizeBox = CastChecked<USizeBox>(Widget);
+		return FVector4(SizeBox->GetWidthOverride(), SizeBox->GetHeightOverride(), 0.f, 0.f);
+	}
+	case EWSTweenProperty::SizeBoxMinOverrides:
+	{
+		const USizeBox* SizeBox = CastChecked<USizeBox>(Widget);
+		return FVector4(SizeBox->GetMinDesiredWidth(), SizeBox->GetMinDesiredHeight(), 0.f, 0.f);
+	}
+	case EWSTweenProperty::RenderTranslation:
+	{
+		const FVector2D Translation = Widget->GetRenderTransform().Translation;
+		return FVector4(Translation.X, Translation.Y, 0.f, 0.f);
+	}
+	case EWSTweenProperty::RenderScale:
+	{
+		const FVector2D Scale = Widget->GetRenderTransform().Scale;
+		return FVector4(Scale.X, Scale.Y, 0.f, 0.f);
+	}
+	case EWSTweenProperty::RenderAngle:
+		return FVector4(Widget->GetRenderTransformAngle(), 0.f, 0.f, 0.f);
+	case EWSTweenProperty::RenderOpacity:
+		return FVector4(Widget->GetRenderOpacity(), 0.f, 0.f, 0.f);
+	case EWSTweenProperty::BrushImageSize:
+	{
+		const FVector2D ImageSize = CastChecked<UImage>(Widget)->GetBrush().ImageSize;
+		return FVector4(ImageSize.X, ImageSize.Y, 0.f, 0.f);
+	}
+	default:
+		return FVector4(0.f, 0.f, 0.f, 0.f);
+	}
+}
+
+void FWidgetStudioTweenScheduler::WriteProperty(UWidget* Widget, const EWSTweenProperty Property, const FVector4& Value)
+{
+	const FLinearColor Color(Value.X, Value.Y, Value.Z, Value.W);
+
+	switch (Property)
+	{
+	case EWSTweenProperty::WidgetColor:
+		CastChecked<UUserWidget>(Widget)->SetColorAndOpacity(Color);
+		break;
+	case EWSTweenProperty::ImageColor:
+		CastChecked<UImage>(Widget)->SetColorAndOpacity(Color);
+		break;
+	case EWSTweenProperty::TextColor:
+		CastChecked<UTextBlock>(Widget)->SetColorAndOpacity(FSlateColor(Color));
+		break;
+	case EWSTweenProperty::EditableTextBoxColor:
+		CastChecked<UEditableTextBox>(Widget)->WidgetStyle.SetForegroundColor(Color);
+		break;
+	// Size box channels are only written when they change, so an override that is not set stays disabled
+	case EWSTweenProperty::SizeBoxOverrides:
+	{
+		USizeBox* SizeBox = CastChecked<USizeBox>(Widget);
+		if (SizeBox->GetWidthOverride() != Value.X) { SizeBox->SetWidthOverride(Value.X); }
+		if (SizeBox->GetHeightOverride() != Value.Y) { SizeBox->SetHeightOverride(Value.Y); }
+		break;
+	}
+	case EWSTweenProperty::SizeBoxMinOverrides:
+	{
+		USizeBox* SizeBox = CastChecked<USizeBox>(Widget);
+		if (SizeBox->GetMinDesiredWidth() != Value.X) { SizeBox->SetMinDesiredWidth(Value.X); }
+		if (SizeBox->GetMinDesiredHeight() != Value.Y) { SizeBox->SetMinDesiredHeight(Value.Y); }
+		break;
+	}
+	case EWSTweenProperty::RenderTranslation:
+		Widget->SetRenderTranslation(FVector2D(Value.X, Value.Y));
+		break;
+	case EWSTweenProperty::RenderScale:
+		Widget->SetRenderScale(FVector2D(Value.X, Value.Y));
+		break;
+	case EWSTweenProperty::RenderAngle:
+		Widget->SetRenderTransformAngle(Value.X);
+		break;
+	case EWSTweenProperty::RenderOpacity:
+		Widget->SetRenderOpacity(Value.X);
+		break;
+	case EWSTweenProperty::BrushImageSize:
+		UWidgetStudioFunctionLibrary::SetBrushImageSize(CastChecked<UImage>(Widget), Value.X, Value.Y);
+		break;
+	default:
+		break;
+	}
+}
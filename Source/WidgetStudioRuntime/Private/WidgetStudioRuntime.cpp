@@ -8,16 +8,25 @@
 */
 
 #include "WidgetStudioRuntime.h"
+#include "WSAnimationClock.h"
+#include "WSMaterialRegistry.h"
+#include "WSTweenScheduler.h"
 
 #define LOCTEXT_NAMESPACE "FWidgetStudioRuntime"
 DEFINE_LOG_CATEGORY(LogWidgetStudio);
 
 void FWidgetStudioRuntime::StartupModule()
 {
+	FWidgetStudioMaterialRegistry::Initialize();
+	FWidgetStudioAnimationClock::Initialize();
+	FWidgetStudioTweenScheduler::Initialize();
 }
 
 void FWidgetStudioRuntime::ShutdownModule()
 {
+	FWidgetStudioTweenScheduler::Shutdown();
+	FWidgetStudioAnimationClock::Shutdown();
+	FWidgetStudioMaterialRegistry::Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
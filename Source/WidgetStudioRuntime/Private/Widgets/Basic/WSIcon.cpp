@@ -58,23 +58,24 @@ TSharedRef<SWidget> UWidgetStudioIcon::RebuildWidget()
 	return Widget;
 }
 
-int32 UWidgetStudioIcon::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
-	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
-	bool bParentEnabled) const
+void UWidgetStudioIcon::UpdateAnimationTargets()
 {
-	if (bDisablePainting) { return LayerId; }
-	
 	// Adjust SizeBox dimensions
 	const float ModifiedSize = UWidgetStudioFunctionLibrary::GetSizeByModifier(SizeModifier, IconStyle.Size);
-	UWidgetStudioFunctionLibrary::InterpSizeBoxOverrides(SizeBox, ModifiedSize, ModifiedSize, AnimationTime);
+	if (bAnimateWithRenderTransform)
+	{
+		UWidgetStudioFunctionLibrary::InterpSizeBoxOverridesWithScale(SizeBox, ModifiedSize, ModifiedSize, AnimationTime);
+	}
+	else
+	{
+		UWidgetStudioFunctionLibrary::InterpSizeBoxOverrides(SizeBox, ModifiedSize, ModifiedSize, AnimationTime);
+	}
 
 	// Adjusts icon color
 	if (!IconStyle.bUseNativeColor)
 	{
 		UWidgetStudioFunctionLibrary::InterpImageColor(IconItem, Color, AnimationTime);
 	}
-	
-	return LayerId;
 }
 
 void UWidgetStudioIcon::SynchronizeProperties()
@@ -46,15 +46,6 @@ TSharedRef<SWidget> UWidgetStudioLabel::RebuildWidget()
 	return Widget;
 }
 
-int32 UWidgetStudioLabel::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
-	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
-	bool bParentEnabled) const
-{
-	if (bDisablePainting) { return LayerId; }
-		
-	return LayerId;
-}
-
 void UWidgetStudioLabel::SynchronizeProperties()
 {
 	Super::SynchronizeProperties();
@@ -52,16 +52,10 @@ TSharedRef<SWidget> UWidgetStudioText::RebuildWidget()
 	return Widget;
 }
 
-int32 UWidgetStudioText::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
-	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
-	bool bParentEnabled) const
+void UWidgetStudioText::UpdateAnimationTargets()
 {
-	if (bDisablePainting) { return LayerId; }
-	
 	// Adjusts icon color
 	UWidgetStudioFunctionLibrary::InterpTextColor(TextItem, Color, AnimationTime);
-	
-	return LayerId;
 }
 
 void UWidgetStudioText::SynchronizeProperties()
@@ -116,10 +110,16 @@ void UWidgetStudioText::UpdateStyling()
 	// Update the TextItem widget styling
 	if (TextItem)
 	{
-		FontInfo = TextStyle.Type ==
-			EWSFontType::Custom ? UWidgetStudioFunctionLibrary::ConstructFontInfoFromStyle(TextStyle.CustomStyle) :
-			UWidgetStudioFunctionLibrary::ConstructFontInfoFromTypography(TextStyle.Type);
-		FontInfo.Size = UWidgetStudioFunctionLibrary::GetSizeByModifier(SizeModifier, FontInfo.Size);
+		if (TextStyle.Type == EWSFontType::Custom)
+		{
+			FontInfo = UWidgetStudioFunctionLibrary::ConstructFontInfoFromStyle(TextStyle.CustomStyle);
+			FontInfo.Size = UWidgetStudioFunctionLibrary::GetSizeByModifier(SizeModifier, FontInfo.Size);
+		}
+		else
+		{
+			// Typography fonts are prebuilt for every size modifier when the typography changes
+			FontInfo = UWidgetStudioFunctionLibrary::GetFontInfoFromTypography(TextStyle.Type, SizeModifier);
+		}
 		TextItem->SetFont(FontInfo);
 		TextItem->SetJustification(TextStyle.Justification);
 		TextItem->SetWrappingPolicy(TextStyle.WrappingPolicy);
@@ -33,7 +33,7 @@ TSharedRef<SWidget> UWidgetStudioModernButton::RebuildWidget()
 		Overlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Overlay"));
 		BackgroundOverlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Background Overlay"));
 		BackgroundScaleBox = WidgetTree->ConstructWidget<UScaleBox>(UScaleBox::StaticClass(), TEXT("Background Scale Box"));
-		DropShadow = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("DropShadow"));
+		DropShadow = UWidgetStudioFunctionLibrary::AreDropShadowsEnabled() ? WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("DropShadow")) : nullptr;
 		Background = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Background"));
 		ContentOverlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Content Overlay"));
 		HorizontalContent = WidgetTree->ConstructWidget<UHorizontalBox>(UHorizontalBox::StaticClass(), TEXT("HContent"));
@@ -49,7 +49,7 @@ TSharedRef<SWidget> UWidgetStudioModernButton::RebuildWidget()
 
 		Overlay->AddChild(BackgroundScaleBox);
 		BackgroundScaleBox->AddChild(BackgroundOverlay);
-		BackgroundOverlay->AddChild(DropShadow);
+		if (DropShadow) { BackgroundOverlay->AddChild(DropShadow); }
 		BackgroundOverlay->AddChild(Background);
 
 		Overlay->AddChild(ContentOverlay);
@@ -65,17 +65,8 @@ TSharedRef<SWidget> UWidgetStudioModernButton::RebuildWidget()
 	return Widget;
 }
 
-int32 UWidgetStudioModernButton::NativePaint(
-	const FPaintArgs& Args,
-	const FGeometry& AllottedGeometry,
-	const FSlateRect& MyCullingRect,
-	FSlateWindowElementList& OutDrawElements,
-	int32 LayerId,
-	const FWidgetStyle& InWidgetStyle,
-	bool bParentEnabled) const
+void UWidgetStudioModernButton::UpdateAnimationTargets()
 {
-	if (bDisablePainting) { return LayerId; }
-	
 	if (IsCheckable() && IsCheckedStateLocked())
 	{
 		// Lock opacity
@@ -121,8 +112,6 @@ int32 UWidgetStudioModernButton::NativePaint(
 	{
 		UWidgetStudioFunctionLibrary::InterpWidgetColor(IconItem, TargetContentColor, AnimationTime * 3);
 	}
-	
-	return LayerId;
 }
 
 void UWidgetStudioModernButton::SynchronizeProperties()
@@ -161,6 +150,10 @@ void UWidgetStudioModernButton::InitializeStyling()
 	{
 		Background->SetColorAndOpacity(UWidgetStudioFunctionLibrary::GetColorFromPalette(IsChecked() ? GetCheckedBackgroundColor() : GetStandardBackgroundColor()));
 		Background->SetRenderOpacity(ButtonStyle == EButtonStyle::Content ? 0.f : 1.f);
+	}
+
+	if (DropShadow)
+	{
 		DropShadow->SetRenderOpacity(BaseDropShadowOpacity);
 	}
 	
@@ -513,21 +506,25 @@ void UWidgetStudioModernButton::SetIconPlacement(const EWSPlacement NewIconPlace
 void UWidgetStudioModernButton::SetStandardBackgroundColor(const EPalette NewColor)
 {
 	StandardBackgroundColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernButton::SetCheckedBackgroundColor(const EPalette NewColor)
 {
 	CheckedBackgroundColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernButton::SetStandardContentColor(const EPalette NewColor)
 {
 	StandardContentColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernButton::SetCheckedContentColor(const EPalette NewColor)
 {
 	CheckedContentColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernButton::SetCornerStyle(const ECornerStyle NewCornerStyle)
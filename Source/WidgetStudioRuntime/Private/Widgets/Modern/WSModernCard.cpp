@@ -29,14 +29,14 @@ TSharedRef<SWidget> UWidgetStudioModernCard::RebuildWidget()
 		SizeBox = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass(), TEXT("Size Box"));
 		ScaleBox = WidgetTree->ConstructWidget<UScaleBox>(UScaleBox::StaticClass(), TEXT("Scale Box"));
 		Overlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Overlay"));
-		DropShadow = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("DropShadow"));
+		DropShadow = UWidgetStudioFunctionLibrary::AreDropShadowsEnabled() ? WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("DropShadow")) : nullptr;
 		Background = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Background"));
 			
 		// Construct Hierarchy
 		RootWidget->AddChild(SizeBox);
 		SizeBox->AddChild(ScaleBox);
 		ScaleBox->AddChild(Overlay);
-		Overlay->AddChild(DropShadow);
+		if (DropShadow) { Overlay->AddChild(DropShadow); }
 		Overlay->AddChild(Background);
 
 		// Additional Construction Parameters
@@ -49,12 +49,8 @@ TSharedRef<SWidget> UWidgetStudioModernCard::RebuildWidget()
 	return Widget;
 }
 
-int32 UWidgetStudioModernCard::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
-	const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId,
-	const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+void UWidgetStudioModernCard::UpdateAnimationTargets()
 {
-	if (bDisablePainting) { return LayerId; }
-	
 	// Smoothly update Size Box
 	UWidgetStudioFunctionLibrary::InterpSizeBoxMinOverrides(SizeBox, GetDimensions().X, GetDimensions().Y, 0);
 	
@@ -78,8 +74,6 @@ int32 UWidgetStudioModernCard::NativePaint(const FPaintArgs& Args, const FGeomet
 		const float NewDropShadowLoc = ShadowStyle == EShadowStyle::Long ? 5.f : 3.0f;
 		UWidgetStudioFunctionLibrary::InterpWidgetTranslation(DropShadow, FVector2D(0, IsHovered() && bEnableShadowHoverAnimation ? NewDropShadowLoc + 2.f : NewDropShadowLoc), AnimationTime);
 	}
-	
-	return LayerId;
 }
 
 void UWidgetStudioModernCard::SynchronizeProperties()
@@ -32,7 +32,7 @@ TSharedRef<SWidget> UWidgetStudioModernCheckBox::RebuildWidget()
 		SizeBox = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass(), TEXT("SizeBox"));
 		BackgroundScaleBox = WidgetTree->ConstructWidget<UScaleBox>(UScaleBox::StaticClass(), TEXT("Background Scale Box"));
 		BackgroundOverlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Background Overlay"));
-		DropShadow = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("DropDown"));
+		DropShadow = UWidgetStudioFunctionLibrary::AreDropShadowsEnabled() ? WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("DropDown")) : nullptr;
 		Background = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Background"));
 		BackgroundOutline = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Background Outline"));
 		CheckScaleBox = WidgetTree->ConstructWidget<UScaleBox>(UScaleBox::StaticClass(), TEXT("Check Scale Box"));
@@ -50,7 +50,7 @@ TSharedRef<SWidget> UWidgetStudioModernCheckBox::RebuildWidget()
 		
 		Overlay->AddChild(BackgroundScaleBox);
 		BackgroundScaleBox->AddChild(BackgroundOverlay);
-		BackgroundOverlay->AddChild(DropShadow);
+		if (DropShadow) { BackgroundOverlay->AddChild(DropShadow); }
 		BackgroundOverlay->AddChild(Background);
 		BackgroundOverlay->AddChild(BackgroundOutline);
 		
@@ -74,22 +74,30 @@ TSharedRef<SWidget> UWidgetStudioModernCheckBox::RebuildWidget()
 	return Widget;
 }
 
-int32 UWidgetStudioModernCheckBox::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
-	const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId,
-	const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+void UWidgetStudioModernCheckBox::UpdateAnimationTargets()
 {
-	if (bDisablePainting) { return LayerId; }
-	
 	/* Smoothly update size */
 	const float SizeX = GetDimensions().X;
 	const float SizeY = GetDimensions().Y;
 	UWidgetStudioFunctionLibrary::InterpSizeBoxMinOverrides(SizeBox, SizeX, SizeY, 0);
-	UWidgetStudioFunctionLibrary::InterpBrushImageSize(DropShadow, SizeY, SizeY, AnimationTime);
-	UWidgetStudioFunctionLibrary::InterpBrushImageSize(Background, SizeY, SizeY, AnimationTime);
-	UWidgetStudioFunctionLibrary::InterpBrushImageSize(BackgroundOutline, SizeY, SizeY, AnimationTime);
-	
-	UWidgetStudioFunctionLibrary::InterpBrushImageSize(CheckBackground, SizeY, SizeY, AnimationTime);
-	UWidgetStudioFunctionLibrary::InterpBrushImageSize(CheckOutline, SizeY, SizeY, AnimationTime);
+	if (bAnimateWithRenderTransform)
+	{
+		UWidgetStudioFunctionLibrary::InterpBrushImageSizeWithScale(DropShadow, SizeY, SizeY, AnimationTime);
+		UWidgetStudioFunctionLibrary::InterpBrushImageSizeWithScale(Background, SizeY, SizeY, AnimationTime);
+		UWidgetStudioFunctionLibrary::InterpBrushImageSizeWithScale(BackgroundOutline, SizeY, SizeY, AnimationTime);
+
+		UWidgetStudioFunctionLibrary::InterpBrushImageSizeWithScale(CheckBackground, SizeY, SizeY, AnimationTime);
+		UWidgetStudioFunctionLibrary::InterpBrushImageSizeWithScale(CheckOutline, SizeY, SizeY, AnimationTime);
+	}
+	else
+	{
+		UWidgetStudioFunctionLibrary::InterpBrushImageSize(DropShadow, SizeY, SizeY, AnimationTime);
+		UWidgetStudioFunctionLibrary::InterpBrushImageSize(Background, SizeY, SizeY, AnimationTime);
+		UWidgetStudioFunctionLibrary::InterpBrushImageSize(BackgroundOutline, SizeY, SizeY, AnimationTime);
+
+		UWidgetStudioFunctionLibrary::InterpBrushImageSize(CheckBackground, SizeY, SizeY, AnimationTime);
+		UWidgetStudioFunctionLibrary::InterpBrushImageSize(CheckOutline, SizeY, SizeY, AnimationTime);
+	}
 	
 	/* Smoothly update DropShadow opacity */
 	const float NewDropShadowOpacity = IsHovered() ? 0.5f : 0.35f;
@@ -140,8 +148,6 @@ int32 UWidgetStudioModernCheckBox::NativePaint(const FPaintArgs& Args, const FGe
 	/* Smoothly update check icon opacity */
 	const float NewTextOpacity = IsChecked() ? 1.f : 0.85f;
 	UWidgetStudioFunctionLibrary::InterpWidgetOpacity(TextItem, NewTextOpacity, AnimationTime);
-	
-	return LayerId;
 }
 
 void UWidgetStudioModernCheckBox::SynchronizeProperties()
@@ -384,6 +390,7 @@ EClusivity UWidgetStudioModernCheckBox::GetSelectionMethod() const
 void UWidgetStudioModernCheckBox::SetSelectionMethod(const EClusivity NewState)
 {
 	Clusivity = NewState;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernCheckBox::SetIcon(const EIconItem NewIcon)
@@ -395,16 +402,19 @@ void UWidgetStudioModernCheckBox::SetIcon(const EIconItem NewIcon)
 void UWidgetStudioModernCheckBox::SetBackgroundColor(const EPalette NewColor)
 {
 	BackgroundColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernCheckBox::SetContentColor(const EPalette NewColor)
 {
 	ContentColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernCheckBox::SetCheckedColor(const EPalette NewColor)
 {
 	CheckedColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 
@@ -50,7 +50,7 @@ TSharedRef<SWidget> UWidgetStudioModernComboBox::RebuildWidget()
 		ContentSizeBox = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass(), TEXT("Content Size Box"));
 		ContentScaleBox = WidgetTree->ConstructWidget<UScaleBox>(UScaleBox::StaticClass(), TEXT("Content Scale Box"));
 		ContentOverlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Content Overlay"));
-		DropShadow = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("DropShadow"));
+		DropShadow = UWidgetStudioFunctionLibrary::AreDropShadowsEnabled() ? WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("DropShadow")) : nullptr;
 		Background = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Background"));
 		HBox = WidgetTree->ConstructWidget<UHorizontalBox>(UHorizontalBox::StaticClass(), TEXT("HBox"));
 		IconItem = WidgetTree->ConstructWidget<UWidgetStudioIcon>(UWidgetStudioIcon::StaticClass(), TEXT("Icon Item"));
@@ -58,6 +58,9 @@ TSharedRef<SWidget> UWidgetStudioModernComboBox::RebuildWidget()
 		ArrowItem = WidgetTree->ConstructWidget<UWidgetStudioIcon>(UWidgetStudioIcon::StaticClass(), TEXT("Arrow Item"));
 		MenuAnchor = WidgetTree->ConstructWidget<UMenuAnchor>(UMenuAnchor::StaticClass(), TEXT("Menu Anchor"));
 
+		// The menu belongs to the previous anchor
+		Menu = nullptr;
+
 				
 		// Construct Hierarchy 	
 		RootWidget->AddChild(VBox);
@@ -67,7 +70,7 @@ TSharedRef<SWidget> UWidgetStudioModernComboBox::RebuildWidget()
 
 		ContentSizeBox->AddChild(ContentScaleBox);
 		ContentScaleBox->AddChild(ContentOverlay);
-		ContentOverlay->AddChild(DropShadow);
+		if (DropShadow) { ContentOverlay->AddChild(DropShadow); }
 		ContentOverlay->AddChild(Background);
 		ContentOverlay->AddChild(HBox);
 		ContentOverlay->AddChild(MenuAnchor);
@@ -84,12 +87,8 @@ TSharedRef<SWidget> UWidgetStudioModernComboBox::RebuildWidget()
 	return Widget;
 }
 
-int32 UWidgetStudioModernComboBox::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
-	const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId,
-	const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+void UWidgetStudioModernComboBox::UpdateAnimationTargets()
 {
-	if (bDisablePainting) { return LayerId; }
-	
 	// Smoothly Update SizeBox 
 	UWidgetStudioFunctionLibrary::InterpSizeBoxMinOverrides(ContentSizeBox, GetDimensions().X, GetDimensions().Y, AnimationTime);
 	//UWidgetStudioFunctionLibrary::InterpSizeBoxOverrides(ContentSizeBox, 0, GetDimensions().Y, AnimationTime);
@@ -109,8 +108,6 @@ int32 UWidgetStudioModernComboBox::NativePaint(const FPaintArgs& Args, const FGe
 	UWidgetStudioFunctionLibrary::InterpWidgetColor(LabelItem, LabelColor, AnimationTime);
 	UWidgetStudioFunctionLibrary::InterpWidgetColor(TextItem, ContentColor, AnimationTime);
 	UWidgetStudioFunctionLibrary::InterpWidgetOpacity(TextItem, GetCurrentIndex() != -1 || bIsSelectable ? 1.0f : 0.5f, AnimationTime);
-	
-	return LayerId;
 }
 
 void UWidgetStudioModernComboBox::SynchronizeProperties()
@@ -262,6 +259,7 @@ void UWidgetStudioModernComboBox::InitializeStyling()
 		Cast<UOverlaySlot>(MenuAnchor->Slot)->SetVerticalAlignment(VAlign_Bottom);
 
 		MenuAnchor->OnGetUserMenuContentEvent.BindUFunction(this, "ConstructMenu");
+		MenuAnchor->OnMenuOpenChanged.AddUniqueDynamic(this, &UWidgetStudioModernComboBox::OnMenuOpenChanged);
 	}
 }
 
@@ -297,9 +295,9 @@ void UWidgetStudioModernComboBox::UpdateStyling()
 		IconItem->SetUseNativeColor(IconStyle.bUseNativeColor);
 		Cast<UHorizontalBoxSlot>(IconItem->Slot)->SetHorizontalAlignment(ContentAlignment);
 		
-		if (GetCurrentIndex() > -1 && bIsSelectable)
+		if (Options.IsValidIndex(GetCurrentIndex()) && bIsSelectable)
 		{
-			const auto Option = GetCurrentOption();
+			const FButtonOptions& Option = Options[GetCurrentIndex()];
 			TextItem->SetText(Option.Text);
 			TextItem->SetVisibility(Option.ContentStyle == EButtonContentStyle::Label || Option.ContentStyle == EButtonContentStyle::IconWithLabel ? ESlateVisibility::SelfHitTestInvisible : ESlateVisibility::Hidden);
 
@@ -342,6 +340,11 @@ FReply UWidgetStudioModernComboBox::NativeOnMouseButtonDown(const FGeometry& InG
 	return FReply::Unhandled();
 }
 
+void UWidgetStudioModernComboBox::OnMenuOpenChanged(const bool bIsOpen)
+{
+	MarkAnimationTargetsDirty();
+}
+
 void UWidgetStudioModernComboBox::OnMenuButtonSelected(const int32 Index, FButtonOptions Option)
 {
 	SetCurrentIndex(Index, true);
@@ -349,30 +352,150 @@ void UWidgetStudioModernComboBox::OnMenuButtonSelected(const int32 Index, FButto
 	MenuAnchor->Close();
 }
 
-UUserWidget* UWidgetStudioModernComboBox::ConstructMenu() const
-{
-	UWidgetStudioModernTabBar* MenuBar = CreateWidget<UWidgetStudioModernTabBar>(MenuAnchor);
-	MenuBar->SetScrollable(true);
-	MenuBar->SetSizeConstraint(MenuHeight);
-	MenuBar->SizeModifier = SizeModifier;
-	MenuBar->OverrideDimensions = OverrideDimensions;
-	MenuBar->SetOrientation(Orient_Vertical);
-	MenuBar->SetScrollbarVisibility(ESlateVisibility::Collapsed);
-	MenuBar->SetSelectable(bIsSelectable);
-	MenuBar->SetBackgroundColor(BackgroundColor);
-	MenuBar->SetContentColor(ContentColor);
-	MenuBar->SetSelectionColor(SelectionColor);
-	MenuBar->SetTextOptions(TextStyle);
-	MenuBar->SetIconOptions(IconStyle);
-	MenuBar->SetContentAlignment(ContentAlignment);
-	MenuBar->SetIconPlacement(IconPlacement);
-	MenuBar->SetOptions(GetOptions());
-	MenuBar->ForceStyleUpdate();
-	
-	MenuBar->OnCurrentIndexChanged.AddDynamic(this, &UWidgetStudioModernComboBox::OnMenuButtonSelected);
-	MenuBar->OnHoverStateChanged.AddDynamic(this, &UWidgetStudioModernComboBox::IndividualHoverStateChanged);
+UUserWidget* UWidgetStudioModernComboBox::ConstructMenu()
+{
+	// Build the menu once and keep it for the following opens
+	if (!Menu)
+	{
+		Menu = CreateWidget<UWidgetStudioModernTabBar>(MenuAnchor);
+
+		if (!Menu) { return nullptr; }
+
+		Menu->SetScrollable(true);
+		Menu->SetOrientation(Orient_Vertical);
+		Menu->SetScrollbarVisibility(ESlateVisibility::Collapsed);
+
+		Menu->OnCurrentIndexChanged.AddDynamic(this, &UWidgetStudioModernComboBox::OnMenuButtonSelected);
+		Menu->OnHoverStateChanged.AddDynamic(this, &UWidgetStudioModernComboBox::IndividualHoverStateChanged);
+
+		ApplyMenuStyling();
+		bAreMenuOptionsOutdated = true;
+	}
+	else if (IsMenuStyleOutdated())
+	{
+		ApplyMenuStyling();
+	}
+
+	// Open without a selection, like a freshly built menu, so picking the current option still closes it. Cleared
+	// first, so new options can't move the menu's selection and report it as picked.
+	if (Menu->GetCurrentIndex() != -1)
+	{
+		Menu->ClearCurrentIndex(false);
+	}
 
-	return MenuBar;
+	if (bAreMenuOptionsOutdated)
+	{
+		if (bVirtualizeMenu)
+		{
+			// The menu only builds the options in view, so it reads them from this combo box rather than copying
+			// and diffing all of them
+			Menu->SetOptionsSource(this);
+		}
+		else
+		{
+			// The menu diffs the options, so only the buttons of the options that changed are rebuilt
+			Menu->SetOptions(TArray<FButtonOptions>(GetOptionsView()));
+		}
+		bAreMenuOptionsOutdated = false;
+	}
+
+	return Menu;
+}
+
+bool UWidgetStudioModernComboBox::IsMenuStyleOutdated() const
+{
+	if (!Menu) { return true; }
+
+	const FWSTextStyle MenuTextStyle = Menu->GetTextOptions();
+	const FWSIconStyle MenuIconStyle = Menu->GetIconOptions();
+
+	return Menu->GetSizeConstraint() != MenuHeight
+		|| Menu->SizeModifier != SizeModifier
+		|| Menu->OverrideDimensions != OverrideDimensions
+		|| Menu->IsSelectable() != bIsSelectable
+		|| Menu->GetBackgroundColor() != BackgroundColor
+		|| Menu->GetContentColor() != ContentColor
+		|| Menu->GetSelectionColor() != SelectionColor
+		|| Menu->GetContentAlignment() != ContentAlignment
+		|| Menu->GetIconPlacement() != IconPlacement
+		|| Menu->IsVirtualized() != bVirtualizeMenu
+		|| !FWSTextStyle::StaticStruct()->CompareScriptStruct(&MenuTextStyle, &TextStyle, PPF_None)
+		|| !FWSIconStyle::StaticStruct()->CompareScriptStruct(&MenuIconStyle, &IconStyle, PPF_None);
+}
+
+void UWidgetStudioModernComboBox::ApplyMenuStyling()
+{
+	// These only store the property
+	Menu->SizeModifier = SizeModifier;
+	Menu->OverrideDimensions = OverrideDimensions;
+	Menu->SetSelectable(bIsSelectable);
+	Menu->SetBackgroundColor(BackgroundColor);
+	Menu->SetContentColor(ContentColor);
+	Menu->SetSelectionColor(SelectionColor);
+
+	// These restyle the whole menu each, so only call the ones that changed
+	const FWSTextStyle MenuTextStyle = Menu->GetTextOptions();
+	const FWSIconStyle MenuIconStyle = Menu->GetIconOptions();
+	bool bHasSynchronized = false;
+	if (Menu->GetSizeConstraint() != MenuHeight)
+	{
+		Menu->SetSizeConstraint(MenuHeight);
+		bHasSynchronized = true;
+	}
+	if (!FWSTextStyle::StaticStruct()->CompareScriptStruct(&MenuTextStyle, &TextStyle, PPF_None))
+	{
+		Menu->SetTextOptions(TextStyle);
+		bHasSynchronized = true;
+	}
+	if (!FWSIconStyle::StaticStruct()->CompareScriptStruct(&MenuIconStyle, &IconStyle, PPF_None))
+	{
+		Menu->SetIconOptions(IconStyle);
+		bHasSynchronized = true;
+	}
+	if (Menu->GetContentAlignment() != ContentAlignment)
+	{
+		Menu->SetContentAlignment(ContentAlignment);
+		bHasSynchronized = true;
+	}
+	if (Menu->GetIconPlacement() != IconPlacement)
+	{
+		Menu->SetIconPlacement(IconPlacement);
+		bHasSynchronized = true;
+	}
+	if (Menu->IsVirtualized() != bVirtualizeMenu)
+	{
+		Menu->SetVirtualized(bVirtualizeMenu);
+		bHasSynchronized = true;
+
+		// Only a virtualized menu reads the options from this combo box
+		bAreMenuOptionsOutdated = true;
+	}
+
+	// Restyle the buttons for the stored properties
+	if (!bHasSynchronized)
+	{
+		Menu->RestyleButtons();
+	}
+}
+
+void UWidgetStudioModernComboBox::ConstructOption(const FButtonOptions& Option)
+{
+	bAreMenuOptionsOutdated = true;
+}
+
+void UWidgetStudioModernComboBox::OnOptionsChanged()
+{
+	bAreMenuOptionsOutdated = true;
+
+	// The selected option may have moved, changed or gone
+	UpdateStyling();
+}
+
+void UWidgetStudioModernComboBox::ClearOptions()
+{
+	Super::ClearOptions();
+	bAreMenuOptionsOutdated = true;
+	UpdateStyling();
 }
 
 FText UWidgetStudioModernComboBox::GetLabel() const
@@ -415,6 +538,11 @@ bool UWidgetStudioModernComboBox::IsSelectable() const
 	return bIsSelectable;
 }
 
+bool UWidgetStudioModernComboBox::IsMenuVirtualized() const
+{
+	return bVirtualizeMenu;
+}
+
 void UWidgetStudioModernComboBox::SetLabel(const FText NewLabel)
 {
 	Label = NewLabel;
@@ -434,24 +562,35 @@ void UWidgetStudioModernComboBox::SetCornerStyle(const ECornerStyle NewStyle)
 void UWidgetStudioModernComboBox::SetBackgroundColor(const EPalette NewColor)
 {
 	BackgroundColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernComboBox::SetContentColor(const EPalette NewColor)
 {
 	ContentColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernComboBox::SetSelectionColor(const EPalette NewColor)
 {
 	SelectionColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernComboBox::SetLabelColor(const EPalette NewColor)
 {
 	LabelColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernComboBox::SetSelectable(const bool NewState)
 {
 	bIsSelectable = NewState;
+	MarkAnimationTargetsDirty();
+}
+
+void UWidgetStudioModernComboBox::SetVirtualizeMenu(const bool NewState)
+{
+	// The menu picks up the change from IsMenuStyleOutdated when it opens
+	bVirtualizeMenu = NewState;
 }
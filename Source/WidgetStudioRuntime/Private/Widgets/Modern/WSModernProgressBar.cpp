@@ -45,7 +45,7 @@ TSharedRef<SWidget> UWidgetStudioModernProgressBar::RebuildWidget()
 		Overlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Overlay"));
 		TrackScaleBox = WidgetTree->ConstructWidget<UScaleBox>(UScaleBox::StaticClass(), TEXT("Track Scale Box"));
 		TrackOverlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Track Overlay"));
-		TrackDropShadow = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Track DropShadow"));
+		TrackDropShadow = UWidgetStudioFunctionLibrary::AreDropShadowsEnabled() ? WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Track DropShadow")) : nullptr;
 		Track = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Track0"));
 		FillTrackSizeBox = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass(), TEXT("Fill Track Size Box"));
 		FillTrack = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Fill Track"));
@@ -58,7 +58,7 @@ TSharedRef<SWidget> UWidgetStudioModernProgressBar::RebuildWidget()
 		
 		Overlay->AddChild(TrackScaleBox);
 		TrackScaleBox->AddChild(TrackOverlay);
-		TrackOverlay->AddChild(TrackDropShadow);
+		if (TrackDropShadow) { TrackOverlay->AddChild(TrackDropShadow); }
 		TrackOverlay->AddChild(Track);
 
 		Overlay->AddChild(FillTrackSizeBox);
@@ -76,12 +76,8 @@ TSharedRef<SWidget> UWidgetStudioModernProgressBar::RebuildWidget()
 	return Widget;
 }
 
-int32 UWidgetStudioModernProgressBar::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
-	const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId,
-	const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+void UWidgetStudioModernProgressBar::UpdateAnimationTargets()
 {
-	if (bDisablePainting) { return LayerId; }
-	
 	/* Smoothly update size box */
 	UWidgetStudioFunctionLibrary::InterpSizeBoxMinOverrides(SizeBox, GetDimensions().X, 0, AnimationTime);
 	
@@ -102,26 +98,23 @@ int32 UWidgetStudioModernProgressBar::NativePaint(const FPaintArgs& Args, const
 	if (bDisplayIndicator)
 	{
 		const float TargetIndicatorWidth = bForwardProgress ? NewFillWidth : 0.f;
-		float NewIndicatorWidth;
 
+		// Restart the sweep once the indicator reaches the end
 		if (IndicatorSizeBox->GetWidthOverride() == TargetIndicatorWidth)
 		{
-			NewIndicatorWidth = bForwardProgress ? 0.f : NewFillWidth;
+			IndicatorSizeBox->SetWidthOverride(bForwardProgress ? 0.f : NewFillWidth);
 		}
 		else
 		{
-			NewIndicatorWidth = UKismetMathLibrary::FInterpTo(
-				IndicatorSizeBox->GetWidthOverride(),
-				TargetIndicatorWidth,
-				GetWorld()->GetDeltaSeconds(),
-				AnimationTime * .5f
-			);
+			UWidgetStudioFunctionLibrary::InterpSizeBoxOverrides(IndicatorSizeBox, TargetIndicatorWidth, IndicatorSizeBox->GetHeightOverride(), AnimationTime * .5f, false);
 		}
-		IndicatorSizeBox->SetWidthOverride(NewIndicatorWidth);
+
+		const float NewIndicatorWidth = IndicatorSizeBox->GetWidthOverride();
 		IndicatorSizeBox->SetRenderOpacity(UKismetMathLibrary::MapRangeClamped(NewIndicatorWidth, 0.f, NewFillWidth, bForwardProgress ? 0.5f : 0.0f, bForwardProgress ? 0.0f : 0.75f));
-	}
 
-	return LayerId;
+		// The indicator sweeps continuously, so its targets are refreshed every tick
+		MarkAnimationTargetsDirty();
+	}
 }
 
 void UWidgetStudioModernProgressBar::SynchronizeProperties()
@@ -296,6 +289,7 @@ void UWidgetStudioModernProgressBar::SetProgress(const float NewValue)
 	bForwardProgress = TempValue >= Percent;
 	Percent = TempValue;
 	OnProgressChanged.Broadcast(Percent);
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernProgressBar::SetIndicatorVisibility(const bool bNewState)
@@ -307,9 +301,11 @@ void UWidgetStudioModernProgressBar::SetIndicatorVisibility(const bool bNewState
 void UWidgetStudioModernProgressBar::SetTrackColor(const EPalette NewColor)
 {
 	TrackColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernProgressBar::SetFillColor(const EPalette NewColor)
 {
 	FillColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
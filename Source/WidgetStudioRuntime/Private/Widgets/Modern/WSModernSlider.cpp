@@ -60,14 +60,14 @@ TSharedRef<SWidget> UWidgetStudioModernSlider::RebuildWidget()
 		Overlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Overlay"));
 		TrackScaleBox = WidgetTree->ConstructWidget<UScaleBox>(UScaleBox::StaticClass(), TEXT("Track Scale Box"));
 		TrackOverlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Track Overlay"));
-		TrackDropShadow = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Track DropShadow"));
+		TrackDropShadow = UWidgetStudioFunctionLibrary::AreDropShadowsEnabled() ? WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Track DropShadow")) : nullptr;
 		Track = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Track0"));
 		FillTrackSizeBox = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass(), TEXT("Fill Track Size Box"));
 		FillTrack = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Fill Track"));
 		HandleScaleBox = WidgetTree->ConstructWidget<UScaleBox>(UScaleBox::StaticClass(), TEXT("Handle Scale Box"));
 		HandleSizeBox = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass(), TEXT("Handle Size Box"));
 		HandleOverlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Handle Overlay"));
-		HandleDropShadow = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Handle DropShadow"));
+		HandleDropShadow = UWidgetStudioFunctionLibrary::AreDropShadowsEnabled() ? WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Handle DropShadow")) : nullptr;
 		Handle = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Handle"));
 		SliderItem = WidgetTree->ConstructWidget<USlider>(USlider::StaticClass(), TEXT("Slider Item"));
 		TextInputSizeBox = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass(), TEXT("Text Input Size Box"));
@@ -81,7 +81,7 @@ TSharedRef<SWidget> UWidgetStudioModernSlider::RebuildWidget()
 		
 		Overlay->AddChild(TrackScaleBox);
 		TrackScaleBox->AddChild(TrackOverlay);
-		TrackOverlay->AddChild(TrackDropShadow);
+		if (TrackDropShadow) { TrackOverlay->AddChild(TrackDropShadow); }
 		TrackOverlay->AddChild(Track);
 
 		Overlay->AddChild(FillTrackSizeBox);
@@ -90,7 +90,7 @@ TSharedRef<SWidget> UWidgetStudioModernSlider::RebuildWidget()
 		Overlay->AddChild(HandleScaleBox);
 		HandleScaleBox->AddChild(HandleSizeBox);
 		HandleSizeBox->AddChild(HandleOverlay);
-		HandleOverlay->AddChild(HandleDropShadow);
+		if (HandleDropShadow) { HandleOverlay->AddChild(HandleDropShadow); }
 		HandleOverlay->AddChild(Handle);
 
 		Overlay->AddChild(SliderItem);
@@ -108,12 +108,8 @@ TSharedRef<SWidget> UWidgetStudioModernSlider::RebuildWidget()
 	return Widget;
 }
 
-int32 UWidgetStudioModernSlider::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
-	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
-	bool bParentEnabled) const
+void UWidgetStudioModernSlider::UpdateAnimationTargets()
 {
-	if (bDisablePainting) { return LayerId; }
-	
 	// Smoothly lerp size box
 	UWidgetStudioFunctionLibrary::InterpSizeBoxMinOverrides(SizeBox, GetDimensions().X, 0, AnimationTime);
 	
@@ -133,7 +129,15 @@ int32 UWidgetStudioModernSlider::NativePaint(const FPaintArgs& Args, const FGeom
 	UWidgetStudioFunctionLibrary::InterpWidgetColor(LabelItem, TextColor, AnimationTime);
 
 	/* Smoothly lerp handle based on hover state */
-	UWidgetStudioFunctionLibrary::InterpSizeBoxOverrides(HandleSizeBox, IsHovered() ? HandleSizeBox->GetHeightOverride() * 2.5f : HandleSizeBox->GetHeightOverride(), 0.f, AnimationTime * 3.f);
+	const float NewHandleWidth = IsHovered() ? HandleSizeBox->GetHeightOverride() * 2.5f : HandleSizeBox->GetHeightOverride();
+	if (bAnimateWithRenderTransform)
+	{
+		UWidgetStudioFunctionLibrary::InterpSizeBoxOverridesWithScale(HandleSizeBox, NewHandleWidth, 0.f, AnimationTime * 3.f);
+	}
+	else
+	{
+		UWidgetStudioFunctionLibrary::InterpSizeBoxOverrides(HandleSizeBox, NewHandleWidth, 0.f, AnimationTime * 3.f);
+	}
 
 	/* Smoothly lerp handle location based on value/max */
 	const float HandleHalfWidth = IsHandleVisible() ? HandleOverlay->GetPaintSpaceGeometry().GetLocalSize().X / 2.f : 0.f;
@@ -155,8 +159,6 @@ int32 UWidgetStudioModernSlider::NativePaint(const FPaintArgs& Args, const FGeom
 
 	/* Smoothly lerp handle drop shadow opacity based on hover state */
 	UWidgetStudioFunctionLibrary::InterpWidgetTranslation(HandleDropShadow, FVector2D(0, IsHovered() ? 5.f : 1.f), AnimationTime);
-	
-	return LayerId;
 }
 
 void UWidgetStudioModernSlider::SynchronizeProperties()
@@ -533,6 +535,7 @@ bool UWidgetStudioModernSlider::IsColorBasedOnValueReversed() const
 void UWidgetStudioModernSlider::SetReverseColorOrder(const bool bNewState)
 {
 	bReverseColorOrder = bNewState;
+	MarkAnimationTargetsDirty();
 }
 
 bool UWidgetStudioModernSlider::IsInputEnabled() const
@@ -69,12 +69,8 @@ TSharedRef<SWidget> UWidgetStudioModernSpinBox::RebuildWidget()
 	return Widget;
 }
 
-int32 UWidgetStudioModernSpinBox::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
-	const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId,
-	const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+void UWidgetStudioModernSpinBox::UpdateAnimationTargets()
 {
-	if (bDisablePainting) { return LayerId; } 
-	
 	/* Smoothly update size */
 	UWidgetStudioFunctionLibrary::InterpSizeBoxOverrides(SizeBox, 0, GetDimensions().Y * .75f, AnimationTime);
 	UWidgetStudioFunctionLibrary::InterpSizeBoxMinOverrides(SizeBox, GetDimensions().X, 0, AnimationTime);
@@ -91,8 +87,6 @@ int32 UWidgetStudioModernSpinBox::NativePaint(const FPaintArgs& Args, const FGeo
 	 */
 	UWidgetStudioFunctionLibrary::InterpWidgetOpacity(ArrowRight, IsHovered() ? .75f : .0f, AnimationTime);
 	UWidgetStudioFunctionLibrary::InterpWidgetOpacity(ArrowLeft, IsHovered() ? .75f : .0f, AnimationTime);
-	
-	return LayerId;
 }
 
 FReply UWidgetStudioModernSpinBox::NativeOnMouseButtonDown(const FGeometry& InGeometry,
@@ -446,6 +440,11 @@ bool UWidgetStudioModernSpinBox::IsDragInputEnabled() const
 	return bEnableDragInput;
 }
 
+bool UWidgetStudioModernSpinBox::HasAnimationPriority() const
+{
+	return bIsPressed || Super::HasAnimationPriority();
+}
+
 void UWidgetStudioModernSpinBox::SetDragInputEnabled(const bool bState)
 {
 	bEnableDragInput = bState;
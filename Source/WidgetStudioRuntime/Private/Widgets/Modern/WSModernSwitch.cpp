@@ -31,11 +31,11 @@ TSharedRef<SWidget> UWidgetStudioModernSwitch::RebuildWidget()
 		TrackSizeBox = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass(), TEXT("Track Size Box"));
 		TrackScaleBox = WidgetTree->ConstructWidget<UScaleBox>(UScaleBox::StaticClass(), TEXT("Track Scale Box"));
 		TrackOverlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Track Overlay"));
-		TrackDropShadow = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Track DropShadow"));
+		TrackDropShadow = UWidgetStudioFunctionLibrary::AreDropShadowsEnabled() ? WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Track DropShadow")) : nullptr;
 		Track = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Track0"));
 		HandleScaleBox = WidgetTree->ConstructWidget<UScaleBox>(UScaleBox::StaticClass(), TEXT("Handle Scale Box"));
 		HandleOverlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Handle Overlay"));
-		HandleDropShadow = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Handle DropShadow"));
+		HandleDropShadow = UWidgetStudioFunctionLibrary::AreDropShadowsEnabled() ? WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Handle DropShadow")) : nullptr;
 		Handle = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Handle"));
 		LabelItem = WidgetTree->ConstructWidget<UWidgetStudioText>(UWidgetStudioText::StaticClass(), TEXT("Label Item"));
 
@@ -48,12 +48,12 @@ TSharedRef<SWidget> UWidgetStudioModernSwitch::RebuildWidget()
 		Overlay->AddChild(TrackSizeBox);
 		TrackSizeBox->AddChild(TrackScaleBox);
 		TrackScaleBox->AddChild(TrackOverlay);
-		TrackOverlay->AddChild(TrackDropShadow);
+		if (TrackDropShadow) { TrackOverlay->AddChild(TrackDropShadow); }
 		TrackOverlay->AddChild(Track);
 
 		Overlay->AddChild(HandleScaleBox);
 		HandleScaleBox->AddChild(HandleOverlay);
-		HandleOverlay->AddChild(HandleDropShadow);
+		if (HandleDropShadow) { HandleOverlay->AddChild(HandleDropShadow); }
 		HandleOverlay->AddChild(Handle);
 
 		if (LabelPlacement == ELabelPlacement::Right || LabelPlacement == ELabelPlacement::Hide) { HBox->AddChild(LabelItem); }
@@ -66,12 +66,8 @@ TSharedRef<SWidget> UWidgetStudioModernSwitch::RebuildWidget()
 	return Widget;
 }
 
-int32 UWidgetStudioModernSwitch::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
-	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
-	bool bParentEnabled) const
+void UWidgetStudioModernSwitch::UpdateAnimationTargets()
 {
-	if (bDisablePainting) { return LayerId; }
-	
 	/* Smoothly update size */
 	UWidgetStudioFunctionLibrary::InterpSizeBoxOverrides(TrackSizeBox, GetDimensions().Y * 1.5f, GetDimensions().Y * .6f, AnimationTime);
 	
@@ -95,8 +91,6 @@ int32 UWidgetStudioModernSwitch::NativePaint(const FPaintArgs& Args, const FGeom
 
 	/* Smoothly lerp handle drop shadow opacity based on hover state */
 	UWidgetStudioFunctionLibrary::InterpWidgetTranslation(HandleDropShadow, FVector2D(0, IsHovered() ? 5.f : 1.f), AnimationTime);
-	
-	return LayerId;
 }
 
 void UWidgetStudioModernSwitch::SynchronizeProperties()
@@ -331,14 +325,17 @@ void UWidgetStudioModernSwitch::SetLabel(const FText NewLabel)
 void UWidgetStudioModernSwitch::SetTrackColor(const EPalette NewColor)
 {
 	TrackColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernSwitch::SetHandleColor(const EPalette NewColor)
 {
 	HandleColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernSwitch::SetLabelColor(const EPalette NewColor)
 {
 	LabelColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
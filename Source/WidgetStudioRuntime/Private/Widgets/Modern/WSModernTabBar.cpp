@@ -17,6 +17,9 @@
 #include "Components/SizeBoxSlot.h"
 #include "Components/UniformGridSlot.h"
 
+/** The number of options above and below the view that keep their buttons while virtualizing. */
+static constexpr int32 VirtualizationOverscan = 2;
+
 TSharedRef<SWidget> UWidgetStudioModernTabBar::RebuildWidget()
 {
 	// Establish the root widget
@@ -27,6 +30,9 @@ TSharedRef<SWidget> UWidgetStudioModernTabBar::RebuildWidget()
 
 	if (RootWidget && WidgetTree)
 	{
+		// Pooled buttons belong to the previous grid
+		ButtonPool.Reset();
+
 		// Construct Widgets
 		SizeBox = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass(), TEXT("SizeBox"));
 		ScrollBox = WidgetTree->ConstructWidget<UWSScrollBox>(UWSScrollBox::StaticClass(), TEXT("Scroll Box"));
@@ -34,7 +40,7 @@ TSharedRef<SWidget> UWidgetStudioModernTabBar::RebuildWidget()
 		ButtonGroup = WidgetTree->ConstructWidget<UWidgetStudioButtonGroup>(UWidgetStudioButtonGroup::StaticClass(), TEXT("Button Group"));
 		BackgroundScaleBox = WidgetTree->ConstructWidget<UScaleBox>(UScaleBox::StaticClass(), TEXT("Background Scale Box"));
 		BackgroundOverlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Background Overlay"));
-		BackgroundDropShadow = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Background DropShadow"));
+		BackgroundDropShadow = UWidgetStudioFunctionLibrary::AreDropShadowsEnabled() ? WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Background DropShadow")) : nullptr;
 		Background = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Background"));
 		SelectionOverlaySize = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass(), TEXT("Selection Overlay Size"));
 		SelectionOverlay = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Selection Overlay"));
@@ -50,7 +56,7 @@ TSharedRef<SWidget> UWidgetStudioModernTabBar::RebuildWidget()
 		Overlay->AddChild(Grid);
 
 		BackgroundScaleBox->AddChild(BackgroundOverlay);
-		BackgroundOverlay->AddChild(BackgroundDropShadow);
+		if (BackgroundDropShadow) { BackgroundOverlay->AddChild(BackgroundDropShadow); }
 		BackgroundOverlay->AddChild(Background);
 		
 		SelectionOverlaySize->AddChild(SelectionOverlay);
@@ -60,21 +66,39 @@ TSharedRef<SWidget> UWidgetStudioModernTabBar::RebuildWidget()
 	return Widget;
 }
 
-int32 UWidgetStudioModernTabBar::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
-	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle,
-	bool bParentEnabled) const
+void UWidgetStudioModernTabBar::NativeTick(const FGeometry& MyGeometry, const float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	// The buttons are only measured once they have been laid out, until then the rows were realized with a guess
+	if (IsVirtualizing() && NumRealized > 0 && !FMath::IsNearlyEqual(MeasureRowHeight(), RealizedRowHeight))
+	{
+		RealizeOptionsInView(true);
+		MarkAnimationTargetsDirty();
+	}
+}
+
+void UWidgetStudioModernTabBar::UpdateAnimationTargets()
 {
-	if (bDisablePainting) { return LayerId; }
-	
 	const float DimX = GetDimensions().X;
 	const float DimY = GetDimensions().Y;
-	const bool IsCurrentIndexValid = GetCurrentIndex() > -1 && GetCurrentIndex() < ButtonGroup->GetButtonCount();
+	UWidgetStudioModernButton* CurrentButton = GetOptionButton(GetCurrentIndex());
+
+	// While virtualizing, the selected option keeps its row after its button has been recycled
+	const bool bIsVirtualizing = IsVirtualizing() && RealizedRowHeight > 0.f;
+	const bool IsCurrentIndexValid = bIsVirtualizing ? GetOptionsView().IsValidIndex(GetCurrentIndex()) : CurrentButton != nullptr;
+	const FMargin GridSlotPadding = GetGridSlotPadding();
 	
 	// Get current button size if valid, otherwise, default to minimal Grid sizing.
 	FVector2D CurrentButtonSize;
-	if (IsCurrentIndexValid)
+	if (CurrentButton)
+	{
+		CurrentButtonSize = CurrentButton->GetPaintSpaceGeometry().GetLocalSize();
+	}
+	else if (IsCurrentIndexValid)
 	{
-		CurrentButtonSize = Grid->GetChildAt(GetCurrentIndex())->GetPaintSpaceGeometry().GetLocalSize();
+		CurrentButtonSize = FVector2D(Grid->GetPaintSpaceGeometry().GetLocalSize().X - GridSlotPadding.GetTotalSpaceAlong<Orient_Horizontal>(),
+			RealizedRowHeight - GridSlotPadding.GetTotalSpaceAlong<Orient_Vertical>());
 	}
 	else
 	{
@@ -120,12 +144,20 @@ int32 UWidgetStudioModernTabBar::NativePaint(const FPaintArgs& Args, const FGeom
 
 	if (Orientation == Orient_Horizontal)
 	{
-		TargetLocation = IsCurrentIndexValid ? Grid->GetChildAt(GetCurrentIndex())->GetPaintSpaceGeometry().GetLocalPositionAtCoordinates(FVector2D(0, 1)).X : 0;
+		TargetLocation = IsCurrentIndexValid ? CurrentButton->GetPaintSpaceGeometry().GetLocalPositionAtCoordinates(FVector2D(0, 1)).X : 0;
 		TargetTranslation = FVector2D(SelectionStyle == ETabBarSelectionStyle::Full ? TargetLocation : TargetLocation + (Width * .5), SelectionStyle == ETabBarSelectionStyle::Full ? 0 : CurrentButtonSize.Y - 3.f);
 	}
 	else
 	{
-		TargetLocation = IsCurrentIndexValid ? Grid->GetChildAt(GetCurrentIndex())->GetPaintSpaceGeometry().GetLocalPositionAtCoordinates(FVector2D(0, 0)).Y : 0;
+		if (bIsVirtualizing)
+		{
+			// Every row is as tall, so the row of the selected option follows from its index
+			TargetLocation = IsCurrentIndexValid ? GetCurrentIndex() * RealizedRowHeight + GridSlotPadding.Top : 0;
+		}
+		else
+		{
+			TargetLocation = IsCurrentIndexValid ? CurrentButton->GetPaintSpaceGeometry().GetLocalPositionAtCoordinates(FVector2D(0, 0)).Y : 0;
+		}
 		TargetTranslation = FVector2D(0, SelectionStyle == ETabBarSelectionStyle::Full ? TargetLocation : TargetLocation + (Height * .5) );
 	}
 
@@ -138,8 +170,6 @@ int32 UWidgetStudioModernTabBar::NativePaint(const FPaintArgs& Args, const FGeom
 	// Smoothly update overlay opacity
 	const float NewSelectionOpacity = bSelectable == true && IsCurrentIndexValid ? 1.f : 0.f;
 	UWidgetStudioFunctionLibrary::InterpWidgetOpacity(SelectionOverlay, NewSelectionOpacity, AnimationTime);
-	
-	return LayerId;
 }
 
 void UWidgetStudioModernTabBar::SynchronizeProperties()
@@ -324,51 +354,276 @@ void UWidgetStudioModernTabBar::UpdateStyling()
 
 }
 
-void UWidgetStudioModernTabBar::ConstructOption(const FButtonOptions Option)
+void UWidgetStudioModernTabBar::ConstructOption(const FButtonOptions& Option)
 {
+	if (IsVirtualizing())
+	{
+		RealizeOptionsInView(true);
+		return;
+	}
+
 	if (Grid && ButtonGroup)
 	{
-		UWidgetStudioModernButton* NewButton = CreateWidget<UWidgetStudioModernButton>(Grid, UWidgetStudioModernButton::StaticClass());
+		// The option has already been appended to the options
+		const int32 Index = GetOptionCount() - 1;
+		UWidgetStudioModernButton* Button = AcquireButton(Index);
 
-		if (!NewButton) {return ;}
-		
-		// Add button to Button Group for management
-		ButtonGroup->AddButton(NewButton);
-
-		// Add child to grid
-		const float GridChildrenCount = Grid->GetChildrenCount();
-		const int32 GridRow = Orientation == Orient_Horizontal ? 0 : GridChildrenCount;
-		const int32 GridColumn =Orientation == Orient_Horizontal ? GridChildrenCount : 0;
-		UUniformGridSlot* GridSlot = Grid->AddChildToUniformGrid(NewButton, GridRow, GridColumn);
-		Cast<UUniformGridSlot>(NewButton->Slot)->SetHorizontalAlignment(HAlign_Fill);
-		Cast<UUniformGridSlot>(NewButton->Slot)->SetVerticalAlignment(VAlign_Fill);
-
-		// Add grid slot styling
-		GridSlot->SetHorizontalAlignment(HAlign_Fill);
-		GridSlot->SetVerticalAlignment(VAlign_Fill);
-
-		// Apply Defaults
-		NewButton->OverrideDimensions = GetDimensions();
-		NewButton->SizeModifier = SizeModifier;
-		NewButton->SetButtonStyle(EButtonStyle::Content);
-		NewButton->SetStandardBackgroundColor(ContentColor);
-		NewButton->SetCheckedContentColor(BackgroundColor);
-		NewButton->SetCheckedBackgroundColor(SelectionStyle == ETabBarSelectionStyle::Full ? BackgroundColor : SelectionColor);
-		NewButton->SetCheckable(bSelectable);
-		NewButton->SetChecked(Grid->GetChildrenCount() - 1 == GetCurrentIndex());
-		NewButton->SetCheckedLockedState(Option.bIsCheckedStateLocked);
-		NewButton->SetTextOptions(TextStyle);
-		NewButton->SetIconOptions(IconStyle);
-		NewButton->SetAlignment(ContentAlignment);
-		NewButton->SetIconPlacement(IconPlacement);
-
-		// Apply from Option
-		NewButton->SetOptions(Option);
-		
-		
-		// Apply Bindings
-		NewButton->OnHoverStateChanged.AddDynamic(this, &UWidgetStudioModernTabBar::IndividualHoverStateChanged);
+		if (!Button) {return ;}
+
+		ActivateButton(Button, Index);
+		ApplyOption(Button, Option, Index);
+
+		Button->OnPressed.RemoveAll(ButtonGroup);
+		ButtonGroup->AddButton(Button);
+	}
+}
+
+void UWidgetStudioModernTabBar::OnOptionsChanging()
+{
+	// The options in view are realized once all changes are in
+	if (!Grid || !ButtonGroup || IsVirtualizing()) { return; }
+
+	bIsDiffingButtons = true;
+	PreviousButtons = ButtonPool;
+	FirstChangedButton = MAX_int32;
+	LastChangedButton = -1;
+}
+
+void UWidgetStudioModernTabBar::OnOptionInserted(const int32 Index)
+{
+	if (!bIsDiffingButtons) { return; }
+
+	// The button is handed over once the buttons left over are known
+	if (ButtonPool.Num() <= Index)
+	{
+		ButtonPool.SetNumZeroed(Index + 1);
+	}
+	ButtonPool[Index] = nullptr;
+	MarkButtonChanged(Index);
+}
+
+void UWidgetStudioModernTabBar::OnOptionRemoved(const int32 Index)
+{
+	if (!bIsDiffingButtons || !PreviousButtons.IsValidIndex(Index)) { return; }
+
+	ParkButton(PreviousButtons[Index]);
+}
+
+void UWidgetStudioModernTabBar::OnOptionMoved(const int32 FromIndex, const int32 ToIndex)
+{
+	if (!bIsDiffingButtons || !PreviousButtons.IsValidIndex(FromIndex)) { return; }
+
+	// The button moves with its option, so only its grid cell changes
+	if (ButtonPool.Num() <= ToIndex)
+	{
+		ButtonPool.SetNumZeroed(ToIndex + 1);
+	}
+	ButtonPool[ToIndex] = PreviousButtons[FromIndex];
+	MarkButtonChanged(ToIndex);
+}
+
+void UWidgetStudioModernTabBar::OnOptionUpdated(const int32 Index)
+{
+	if (!bIsDiffingButtons || !ButtonPool.IsValidIndex(Index) || !ButtonPool[Index]) { return; }
+
+	ApplyOption(ButtonPool[Index], GetOptionsView()[Index], Index);
+}
+
+void UWidgetStudioModernTabBar::OnOptionsChanged()
+{
+	if (!Grid || !ButtonGroup) { return; }
+
+	if (IsVirtualizing())
+	{
+		RealizeOptionsInView(true);
+		return;
+	}
+
+	if (bIsDiffingButtons)
+	{
+		FinishButtonDiff();
 	}
+
+	RegisterButtons();
+	ButtonGroup->SetCurrentIndex(GetCurrentIndex(), false);
+}
+
+void UWidgetStudioModernTabBar::MarkButtonChanged(const int32 Index)
+{
+	FirstChangedButton = FMath::Min(FirstChangedButton, Index);
+	LastChangedButton = FMath::Max(LastChangedButton, Index);
+}
+
+void UWidgetStudioModernTabBar::FinishButtonDiff()
+{
+	bIsDiffingButtons = false;
+
+	const TConstArrayView<FButtonOptions> OptionsView = GetOptionsView();
+	ButtonPool.SetNumZeroed(OptionsView.Num());
+
+	// Every button no option holds on to anymore is a spare, the removed ones have been parked already
+	TSet<UWidgetStudioModernButton*> UsedButtons;
+	UsedButtons.Reserve(ButtonPool.Num());
+	for (UWidgetStudioModernButton* Button : ButtonPool)
+	{
+		UsedButtons.Add(Button);
+	}
+
+	TArray<UWidgetStudioModernButton*> SpareButtons;
+	for (UWidgetStudioModernButton* Button : PreviousButtons)
+	{
+		if (Button && !UsedButtons.Contains(Button))
+		{
+			SpareButtons.Add(Button);
+		}
+	}
+	PreviousButtons.Reset();
+
+	// Only the inserted options are without a button, and they are all in the changed range
+	int32 NumSpareButtonsUsed = 0;
+	const int32 LastChanged = FMath::Min(LastChangedButton, ButtonPool.Num() - 1);
+	for (int32 i = FirstChangedButton; i <= LastChanged; i++)
+	{
+		if (ButtonPool[i]) { continue; }
+
+		UWidgetStudioModernButton* Button = NumSpareButtonsUsed < SpareButtons.Num() ? SpareButtons[NumSpareButtonsUsed++] : CreateButton();
+		if (!Button)
+		{
+			ButtonPool.SetNum(i);
+			break;
+		}
+
+		ButtonPool[i] = Button;
+		ActivateButton(Button, i);
+		ApplyOption(Button, OptionsView[i], i);
+	}
+
+	// Keep the buttons left over behind the buttons in use
+	for (int32 i = NumSpareButtonsUsed; i < SpareButtons.Num(); i++)
+	{
+		ButtonPool.Add(SpareButtons[i]);
+	}
+
+	UpdateButtonCells(FirstChangedButton, LastChanged);
+}
+
+UWidgetStudioModernButton* UWidgetStudioModernTabBar::AcquireButton(const int32 Index)
+{
+	// Buttons are only created when the options outgrow the pool
+	while (ButtonPool.Num() <= Index)
+	{
+		UWidgetStudioModernButton* NewButton = CreateButton();
+
+		if (!NewButton) { return nullptr; }
+
+		ButtonPool.Add(NewButton);
+	}
+
+	return ButtonPool[Index];
+}
+
+UWidgetStudioModernButton* UWidgetStudioModernTabBar::CreateButton()
+{
+	UWidgetStudioModernButton* NewButton = CreateWidget<UWidgetStudioModernButton>(Grid, UWidgetStudioModernButton::StaticClass());
+
+	if (!NewButton) { return nullptr; }
+
+	// Apply Bindings
+	NewButton->OnHoverStateChanged.AddDynamic(this, &UWidgetStudioModernTabBar::IndividualHoverStateChanged);
+
+	return NewButton;
+}
+
+void UWidgetStudioModernTabBar::ActivateButton(UWidgetStudioModernButton* Button, const int32 Index)
+{
+	const int32 GridRow = Orientation == Orient_Horizontal ? 0 : Index;
+	const int32 GridColumn = Orientation == Orient_Horizontal ? Index : 0;
+
+	// Add child to grid, or move it to its cell if it is still there
+	UUniformGridSlot* GridSlot = Cast<UUniformGridSlot>(Button->Slot);
+	if (Button->GetParent() != Grid || !GridSlot)
+	{
+		GridSlot = Grid->AddChildToUniformGrid(Button, GridRow, GridColumn);
+	}
+	else
+	{
+		GridSlot->SetRow(GridRow);
+		GridSlot->SetColumn(GridColumn);
+	}
+
+	// Add grid slot styling
+	GridSlot->SetHorizontalAlignment(HAlign_Fill);
+	GridSlot->SetVerticalAlignment(VAlign_Fill);
+}
+
+void UWidgetStudioModernTabBar::UpdateButtonCells(const int32 FirstIndex, const int32 LastIndex)
+{
+	for (int32 i = FirstIndex; i <= LastIndex && i < ButtonPool.Num(); i++)
+	{
+		if (ButtonPool[i])
+		{
+			ActivateButton(ButtonPool[i], i);
+		}
+	}
+}
+
+void UWidgetStudioModernTabBar::RegisterButtons()
+{
+	ButtonGroup->RemoveAllButtons();
+
+	const int32 NumButtons = IsVirtualizing() ? NumRealized : GetOptionCount();
+	for (int32 i = 0; i < NumButtons && i < ButtonPool.Num(); i++)
+	{
+		// The group does not unbind the buttons it drops, so make sure the button is bound only once
+		ButtonPool[i]->OnPressed.RemoveAll(ButtonGroup);
+		ButtonGroup->AddButton(ButtonPool[i]);
+	}
+}
+
+void UWidgetStudioModernTabBar::ApplyOption(UWidgetStudioModernButton* Button, const FButtonOptions& Option, const int32 Index)
+{
+	// Apply Defaults
+	Button->OverrideDimensions = GetDimensions();
+	Button->SizeModifier = SizeModifier;
+	Button->SetButtonStyle(EButtonStyle::Content);
+	Button->SetStandardBackgroundColor(ContentColor);
+	Button->SetCheckedContentColor(BackgroundColor);
+	Button->SetCheckedBackgroundColor(SelectionStyle == ETabBarSelectionStyle::Full ? BackgroundColor : SelectionColor);
+	Button->SetCheckable(bSelectable);
+	Button->SetChecked(Index == GetCurrentIndex());
+	Button->SetCheckedLockedState(Option.bIsCheckedStateLocked);
+	Button->SetTextOptions(TextStyle);
+	Button->SetIconOptions(IconStyle);
+	Button->SetAlignment(ContentAlignment);
+	Button->SetIconPlacement(IconPlacement);
+
+	// Apply from Option
+	Button->SetOptions(Option);
+}
+
+void UWidgetStudioModernTabBar::ParkButtons(const int32 FirstIndex)
+{
+	// Park from the end so the buttons left in the grid keep their order
+	for (int32 i = ButtonPool.Num() - 1; i >= FirstIndex && i >= 0; i--)
+	{
+		ParkButton(ButtonPool[i]);
+	}
+}
+
+void UWidgetStudioModernTabBar::ParkButton(UWidgetStudioModernButton* Button)
+{
+	if (!Button) { return; }
+
+	if (Button->GetParent())
+	{
+		Button->RemoveFromParent();
+	}
+
+	if (ButtonGroup)
+	{
+		Button->OnPressed.RemoveAll(ButtonGroup);
+	}
+	Button->bIsInteractable = true;
 }
 
 TEnumAsByte<EHorizontalAlignment> UWidgetStudioModernTabBar::GetContentAlignment() const
@@ -471,6 +726,17 @@ ESlateVisibility UWidgetStudioModernTabBar::GetScrollbarVisibility() const
 	return ScrollBarVisibility;
 }
 
+bool UWidgetStudioModernTabBar::IsVirtualized() const
+{
+	return bVirtualizeOptions;
+}
+
+void UWidgetStudioModernTabBar::SetVirtualized(const bool NewState)
+{
+	bVirtualizeOptions = NewState;
+	SynchronizeProperties();
+}
+
 void UWidgetStudioModernTabBar::SetScrollbarVisibility(const ESlateVisibility NewVisibility)
 {
 	ScrollBarVisibility = NewVisibility;
@@ -498,35 +764,53 @@ void UWidgetStudioModernTabBar::SetCornerStyle(const ECornerStyle NewStyle)
 void UWidgetStudioModernTabBar::SetBackgroundColor(const EPalette NewColor)
 {
 	BackgroundColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernTabBar::SetContentColor(const EPalette NewColor)
 {
 	ContentColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernTabBar::SetSelectionColor(const EPalette NewColor)
 {
 	SelectionColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernTabBar::SetSelectable(const bool NewState)
 {
 	bSelectable = NewState;
+	MarkAnimationTargetsDirty();
+}
+
+void UWidgetStudioModernTabBar::RestyleButtons()
+{
+	SynchronizeProperties();
 }
 
 void UWidgetStudioModernTabBar::SetCurrentIndex(const int32 Index, const bool bBroadcast)
 {
 	Super::SetCurrentIndex(Index, bBroadcast);
-	ButtonGroup->SetCurrentIndex(Index, false);
+
+	if (ButtonGroup)
+	{
+		ButtonGroup->SetCurrentIndex(GetButtonIndex(Index), false);
+	}
+}
+
+void UWidgetStudioModernTabBar::SetOptionsSource(const UWidgetStudioContainer* Source)
+{
+	Super::SetOptionsSource(Source);
+
+	// Re-bind the buttons to the options read from the source
+	ConstructButtonGroup();
 }
 
 void UWidgetStudioModernTabBar::ClearOptions()
 {
-	if (Grid)
-	{
-		Grid->ClearChildren();
-	}
+	ParkButtons(0);
 
 	if (ButtonGroup)
 	{
@@ -546,21 +830,166 @@ void UWidgetStudioModernTabBar::ConstructButtonGroup()
 		ButtonGroup->OnCurrentIndexChanged.RemoveAll(this);
 		ButtonGroup->OnCurrentIndexChanged.AddDynamic(this, &UWidgetStudioModernTabBar::UpdateIndexFromButtonGroup);
 
-		// Clear the grid of all children to ready it for applying the options without error.
-		ButtonGroup->RemoveAllButtons();
-		Grid->ClearChildren();
+		if (ScrollBox)
+		{
+			ScrollBox->OnUserScrolled.RemoveAll(this);
+			ScrollBox->OnUserScrolled.AddDynamic(this, &UWidgetStudioModernTabBar::OnScrolled);
+		}
+
+		if (IsVirtualizing())
+		{
+			RealizeOptionsInView(true);
+			return;
+		}
 
-		// Construct options
-		for (int32 i = 0; i < GetOptionCount(); i++)
+		// Stop lining the grid up with the options in view
+		if (NumRealized > 0 || RealizedOffset > 0)
 		{
-			ConstructOption(GetOptions()[i]);
+			Cast<UOverlaySlot>(Grid->Slot)->SetPadding(0);
+			FirstRealizedIndex = 0;
+			NumRealized = 0;
+			RealizedOffset = 0;
+			RealizedRowHeight = 0;
 		}
 
+		// Re-bind the pooled buttons to the options and restyle them in place, parking the buttons left over
+		const TConstArrayView<FButtonOptions> OptionsView = GetOptionsView();
+		for (int32 i = 0; i < OptionsView.Num(); i++)
+		{
+			UWidgetStudioModernButton* Button = AcquireButton(i);
+			if (!Button) { break; }
+
+			ActivateButton(Button, i);
+			ApplyOption(Button, OptionsView[i], i);
+		}
+		ParkButtons(OptionsView.Num());
+		RegisterButtons();
+
 		ButtonGroup->SetCurrentIndex(GetCurrentIndex(), false);
 	}
 }
 
+bool UWidgetStudioModernTabBar::IsVirtualizing() const
+{
+	return bVirtualizeOptions && bEnableScrolling && Orientation == Orient_Vertical && SizeConstraint > 0;
+}
+
+int32 UWidgetStudioModernTabBar::GetButtonIndex(const int32 Index) const
+{
+	if (!IsVirtualizing())
+	{
+		return Index;
+	}
+
+	const int32 ButtonIndex = Index - FirstRealizedIndex;
+	return Index > -1 && ButtonIndex >= 0 && ButtonIndex < NumRealized ? ButtonIndex : -1;
+}
+
+UWidgetStudioModernButton* UWidgetStudioModernTabBar::GetOptionButton(const int32 Index) const
+{
+	const int32 ButtonIndex = GetButtonIndex(Index);
+	if (ButtonGroup && ButtonIndex > -1 && ButtonIndex < ButtonGroup->GetButtonCount() && ButtonPool.IsValidIndex(ButtonIndex))
+	{
+		return ButtonPool[ButtonIndex];
+	}
+	return nullptr;
+}
+
+FMargin UWidgetStudioModernTabBar::GetGridSlotPadding() const
+{
+	if (!Grid) { return FMargin(0); }
+
+#if ENGINE_MAJOR_VERSION == 4 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION < 1)
+	return Grid->SlotPadding;
+#else
+	return Grid->GetSlotPadding();
+#endif
+}
+
+float UWidgetStudioModernTabBar::MeasureRowHeight() const
+{
+	const float MeasuredHeight = ButtonPool.Num() > 0 && ButtonPool[0] ? ButtonPool[0]->GetDesiredSize().Y : 0.f;
+	const float ButtonHeight = MeasuredHeight > 0.f ? MeasuredHeight : GetDimensions().Y;
+	return FMath::Max(ButtonHeight + GetGridSlotPadding().GetTotalSpaceAlong<Orient_Vertical>(), 1.f);
+}
+
+void UWidgetStudioModernTabBar::RealizeOptionsInView(const bool bForce)
+{
+	if (!Grid || !ButtonGroup || !ScrollBox) { return; }
+
+	// Every option is as tall as the buttons, so the options in view follow from the scroll offset
+	const float RowHeight = MeasureRowHeight();
+	const int32 RowsInView = FMath::CeilToInt(SizeConstraint / RowHeight);
+	const int32 FirstInView = FMath::FloorToInt(ScrollBox->GetScrollOffset() / RowHeight);
+
+	const TConstArrayView<FButtonOptions> OptionsView = GetOptionsView();
+	const int32 NewNumRealized = FMath::Min(RowsInView + VirtualizationOverscan * 2, OptionsView.Num());
+	const int32 NewFirstIndex = FMath::Clamp(FirstInView - VirtualizationOverscan, 0, OptionsView.Num() - NewNumRealized);
+
+	if (!bForce && NewFirstIndex == FirstRealizedIndex && NewNumRealized == NumRealized) { return; }
+
+	const int32 Shift = NewFirstIndex - FirstRealizedIndex;
+	if (bForce || NewNumRealized != NumRealized || FMath::Abs(Shift) >= NumRealized)
+	{
+		// Restyle every button in view, parking the buttons left over
+		for (int32 i = 0; i < NewNumRealized; i++)
+		{
+			UWidgetStudioModernButton* Button = AcquireButton(i);
+			if (!Button) { break; }
+
+			ActivateButton(Button, i);
+			ApplyOption(Button, OptionsView[NewFirstIndex + i], NewFirstIndex + i);
+		}
+		ParkButtons(NewNumRealized);
+	}
+	else
+	{
+		// Rotate the buttons so the ones that scrolled out of view end up on the side that scrolled into view.
+		// Only those are restyled, the others keep their options and just move to their new grid cell.
+		TArray<UWidgetStudioModernButton*, TInlineAllocator<64>> Rotated;
+		Rotated.SetNumUninitialized(NumRealized);
+		for (int32 i = 0; i < NumRealized; i++)
+		{
+			Rotated[i] = ButtonPool[((i + Shift) % NumRealized + NumRealized) % NumRealized];
+		}
+
+		for (int32 i = 0; i < NumRealized; i++)
+		{
+			ButtonPool[i] = Rotated[i];
+			ActivateButton(Rotated[i], i);
+
+			const int32 PreviousButtonIndex = i + Shift;
+			if (PreviousButtonIndex < 0 || PreviousButtonIndex >= NumRealized)
+			{
+				ApplyOption(Rotated[i], OptionsView[NewFirstIndex + i], NewFirstIndex + i);
+			}
+		}
+	}
+
+	FirstRealizedIndex = NewFirstIndex;
+	NumRealized = NewNumRealized;
+	RealizedRowHeight = RowHeight;
+	RealizedOffset = FirstRealizedIndex * RowHeight;
+
+	// Pad the grid so it is as tall as all the options and the buttons sit where their options are
+	const float BottomOffset = (OptionsView.Num() - FirstRealizedIndex - NumRealized) * RowHeight;
+	Cast<UOverlaySlot>(Grid->Slot)->SetPadding(FMargin(0, RealizedOffset, 0, BottomOffset));
+
+	RegisterButtons();
+	ButtonGroup->SetCurrentIndex(GetButtonIndex(GetCurrentIndex()), false);
+}
+
+void UWidgetStudioModernTabBar::OnScrolled(const float CurrentOffset)
+{
+	if (IsVirtualizing())
+	{
+		RealizeOptionsInView(false);
+	}
+	MarkAnimationTargetsDirty();
+}
+
 void UWidgetStudioModernTabBar::UpdateIndexFromButtonGroup(const int32 NewIndex)
 {
-	SetCurrentIndex(NewIndex, true);
+	// The Button Group only knows the buttons in view while virtualizing
+	SetCurrentIndex(IsVirtualizing() && NewIndex > -1 ? FirstRealizedIndex + NewIndex : NewIndex, true);
 }
\ No newline at end of file
@@ -34,7 +34,7 @@ TSharedRef<SWidget> UWidgetStudioModernTextField::RebuildWidget()
 		SizeBox = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass(), TEXT("SizeBox"));
 		BackgroundScaleBox = WidgetTree->ConstructWidget<UScaleBox>(UScaleBox::StaticClass(), TEXT("Background Scale Box"));
 		BackgroundOverlay = WidgetTree->ConstructWidget<UOverlay>(UOverlay::StaticClass(), TEXT("Background Overlay"));
-		DropShadow = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("DropDown"));
+		DropShadow = UWidgetStudioFunctionLibrary::AreDropShadowsEnabled() ? WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("DropDown")) : nullptr;
 		Background = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Background"));
 		BackgroundOutline = WidgetTree->ConstructWidget<UImage>(UImage::StaticClass(), TEXT("Background Outline"));
 		HBox = WidgetTree->ConstructWidget<UHorizontalBox>(UHorizontalBox::StaticClass(), TEXT("HBox"));
@@ -57,7 +57,7 @@ TSharedRef<SWidget> UWidgetStudioModernTextField::RebuildWidget()
 		Overlay->AddChild(HBox);
 
 		BackgroundScaleBox->AddChild(BackgroundOverlay);
-		BackgroundOverlay->AddChild(DropShadow);
+		if (DropShadow) { BackgroundOverlay->AddChild(DropShadow); }
 		BackgroundOverlay->AddChild(Background);
 		BackgroundOverlay->AddChild(BackgroundOutline);
 
@@ -78,12 +78,8 @@ TSharedRef<SWidget> UWidgetStudioModernTextField::RebuildWidget()
 	return Widget;
 }
 
-int32 UWidgetStudioModernTextField::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
-	const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId,
-	const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+void UWidgetStudioModernTextField::UpdateAnimationTargets()
 {
-	if (bDisablePainting) { return LayerId; }
-	
 	/* Smoothly update size box */
 	UWidgetStudioFunctionLibrary::InterpSizeBoxMinOverrides(SizeBox, GetDimensions().X, 0, AnimationTime);
 	
@@ -101,8 +97,6 @@ int32 UWidgetStudioModernTextField::NativePaint(const FPaintArgs& Args, const FG
 	UWidgetStudioFunctionLibrary::InterpImageColor(LeadingIconItem, ContentColor, AnimationTime);
 	UWidgetStudioFunctionLibrary::InterpImageColor(TrailingIconItem, ContentColor, AnimationTime);
 	UWidgetStudioFunctionLibrary::InterpTextColor(LabelItem, LabelColor, AnimationTime);
-	
-	return LayerId;
 }
 
 void UWidgetStudioModernTextField::SynchronizeProperties()
@@ -520,9 +514,11 @@ void UWidgetStudioModernTextField::SetTrailingIcon(const EIconItem NewIcon)
 void UWidgetStudioModernTextField::SetBackgroundColor(const EPalette NewColor)
 {
 	BackgroundColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioModernTextField::SetContentColor(const EPalette NewColor)
 {
 	ContentColor = NewColor;
+	MarkAnimationTargetsDirty();
 }
@@ -16,16 +16,34 @@ TSharedRef<SWidget> UWSScrollBox::RebuildWidget()
 	this->SetAnimateWheelScrolling(true);
 
 	// Update the scroll box style to match the current Widget Studio theme settings
-	if (GEngine->IsValidLowLevel())
+	if (GEngine->IsValidLowLevel() && !StyleChangedHandle.IsValid())
 	{
-		GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>()->OnStyleChanged.AddUniqueDynamic(this, &UWSScrollBox::OnStyleChanged);
+		StyleChangedHandle = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>()->OnStyleChangedNative.AddUObject(this, &UWSScrollBox::OnStyleChanged);
 	}
 
 	return Widget;
 }
 
-void UWSScrollBox::OnStyleChanged()
+void UWSScrollBox::ReleaseSlateResources(const bool bReleaseChildren)
 {
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	if (StyleChangedHandle.IsValid())
+	{
+		// The subsystem is gone already when the engine shuts down
+		if (UWidgetStudioSubsystem* WSSubsystem = GEngine ? GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>() : nullptr)
+		{
+			WSSubsystem->OnStyleChangedNative.Remove(StyleChangedHandle);
+		}
+		StyleChangedHandle.Reset();
+	}
+}
+
+void UWSScrollBox::OnStyleChanged(const EWSStyleChange StyleChanges)
+{
+	// The scroll bar brushes only depend on the palette and the border radius
+	if (!EnumHasAnyFlags(StyleChanges, EWSStyleChange::Palette | EWSStyleChange::BorderRadius)) return;
+
 	this->SetWidgetBarStyle(UWidgetStudioFunctionLibrary::GetScrollBarStyle()); // Use setter method
 }
 
@@ -50,19 +50,13 @@ TSharedRef<SWidget> UWidgetStudioDivider::RebuildWidget()
 	return Widget;
 }
 
-int32 UWidgetStudioDivider::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry,
-	const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId,
-	const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+void UWidgetStudioDivider::UpdateAnimationTargets()
 {
-	if (!bDisablePainting)
-	{
-		// Adjusts icon color
-		UWidgetStudioFunctionLibrary::InterpImageColor(ImageItem, Color, AnimationTime);
+	// Adjusts icon color
+	UWidgetStudioFunctionLibrary::InterpImageColor(ImageItem, Color, AnimationTime);
 
-		// Adjust opacity
-		UWidgetStudioFunctionLibrary::InterpWidgetOpacity(ImageItem, Opacity, AnimationTime);
-	}
-	return LayerId;
+	// Adjust opacity
+	UWidgetStudioFunctionLibrary::InterpWidgetOpacity(ImageItem, Opacity, AnimationTime);
 }
 
 void UWidgetStudioDivider::SynchronizeProperties()
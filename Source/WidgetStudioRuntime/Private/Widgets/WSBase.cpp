@@ -17,34 +17,119 @@ void UWidgetStudioBase::InitializeStyling()
 
 void UWidgetStudioBase::UpdateStyling()
 {
+	MarkAnimationTargetsDirty();
 	if (!IsConstructed()) { return; }
 	// Override in child class
 }
 
+void UWidgetStudioBase::UpdateAnimationTargets()
+{
+	// Override in child class
+}
+
+void UWidgetStudioBase::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	MarkAnimationTargetsDirty();
+
+	if (!GEngine) return;
+	if (UWidgetStudioSubsystem* WSSubsystem = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>())
+	{
+		WSSubsystem->RegisterStyledWidget(this);
+	}
+}
+
+void UWidgetStudioBase::NativeDestruct()
+{
+	if (GEngine)
+	{
+		if (UWidgetStudioSubsystem* WSSubsystem = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>())
+		{
+			WSSubsystem->UnregisterStyledWidget(this);
+		}
+	}
+
+	Super::NativeDestruct();
+}
+
+void UWidgetStudioBase::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	LastTickFrame = GFrameCounter;
+
+	// Layout changes move the targets read from the geometry
+	const FVector2D TickSize = MyGeometry.GetLocalSize();
+	if (TickSize != LastTickSize)
+	{
+		LastTickSize = TickSize;
+		MarkAnimationTargetsDirty();
+	}
+
+	// Targets only change with the state of the widget, settled widgets skip the update
+	if (AnimationTargetTicks > 0 && !bDisablePainting)
+	{
+		AnimationTargetTicks--;
+		UpdateAnimationTargets();
+	}
+
+	// A restyle deferred while off screen is queued as soon as the widget is visible again
+	if (StyleRegistryIndex != INDEX_NONE && !bRestyleQueued && AppliedRestyleSerial != UWidgetStudioSubsystem::GetRestyleSerial())
+	{
+		if (UWidgetStudioSubsystem* WSSubsystem = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>())
+		{
+			WSSubsystem->QueueRestyle(this);
+		}
+	}
+}
+
 void UWidgetStudioBase::NativeOnMouseEnter(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent)
 {
 	Super::NativeOnMouseEnter(InGeometry, InMouseEvent);
+	MarkAnimationTargetsDirty();
 	this->OnHoverStateChanged.Broadcast(this, true);
 }
 
 void UWidgetStudioBase::NativeOnMouseLeave(const FPointerEvent& InMouseEvent)
 {
 	Super::NativeOnMouseLeave(InMouseEvent);
+	MarkAnimationTargetsDirty();
 	this->OnHoverStateChanged.Broadcast(this, false);
 }
 
 void UWidgetStudioBase::NativeOnMouseCaptureLost(const FCaptureLostEvent& CaptureLostEvent)
 {
 	Super::NativeOnMouseCaptureLost(CaptureLostEvent);
+	MarkAnimationTargetsDirty();
 	this->OnHoverStateChanged.Broadcast(this, false);
 }
 
+void UWidgetStudioBase::NativeOnAddedToFocusPath(const FFocusEvent& InFocusEvent)
+{
+	Super::NativeOnAddedToFocusPath(InFocusEvent);
+	MarkAnimationTargetsDirty();
+}
+
+void UWidgetStudioBase::NativeOnRemovedFromFocusPath(const FFocusEvent& InFocusEvent)
+{
+	Super::NativeOnRemovedFromFocusPath(InFocusEvent);
+	MarkAnimationTargetsDirty();
+}
+
+void UWidgetStudioBase::SynchronizeProperties()
+{
+	Super::SynchronizeProperties();
+	MarkAnimationTargetsDirty();
+}
+
 FVector2D UWidgetStudioBase::GetDimensions() const
 {
-	const FVector2D ControlDimensions = UWidgetStudioFunctionLibrary::GetControlDimensions();
+	const FWidgetStudioStyleConstants& StyleConstants = UWidgetStudioSubsystem::GetStyleConstants();
+	const float Scale = StyleConstants.GetSizeModifierScale(SizeModifier);
 
-	const float Width = UWidgetStudioFunctionLibrary::GetSizeByModifier(SizeModifier, OverrideDimensions.X > 0 ? OverrideDimensions.X : ControlDimensions.X);
-	const float Height = UWidgetStudioFunctionLibrary::GetSizeByModifier(SizeModifier, OverrideDimensions.Y > 0 ? OverrideDimensions.Y : ControlDimensions.Y);
+	const float Width = Scale * (OverrideDimensions.X > 0 ? OverrideDimensions.X : StyleConstants.IdealWidth);
+	const float Height = Scale * (OverrideDimensions.Y > 0 ? OverrideDimensions.Y : StyleConstants.IdealHeight);
 	
 	return FVector2D(
 		Width > MinimumDimensions.X ? Width : MinimumDimensions.X,
@@ -52,18 +137,25 @@ FVector2D UWidgetStudioBase::GetDimensions() const
 		);
 }
 
+bool UWidgetStudioBase::HasAnimationPriority() const
+{
+	return IsHovered() || HasFocusedDescendants();
+}
+
 int32 UWidgetStudioBase::GetBorderRadius() const
 {
-	return OverrideBorderRadius > -1 ? OverrideBorderRadius : UWidgetStudioFunctionLibrary::GetBorderRadius();
+	return OverrideBorderRadius > -1 ? OverrideBorderRadius : UWidgetStudioSubsystem::GetStyleConstants().BorderRadius;
 }
 
 void UWidgetStudioBase::ForceStyleUpdate()
 {
 	UpdateStyling();
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioBase::SetSizeModifier(const ESizeModifier InSizeModifier)
 {
 	SizeModifier = InSizeModifier;
 	UpdateStyling();
+	MarkAnimationTargetsDirty();
 }
@@ -29,6 +29,7 @@ FReply UWidgetStudioButtonBase::NativeOnMouseButtonDown(const FGeometry& InGeome
 	if (InMouseEvent.IsMouseButtonDown(FKey("LeftMouseButton")))
 	{
 		bIsPressed = true;
+		MarkAnimationTargetsDirty();
 		
 		if (IsCheckable())
 		{
@@ -59,6 +60,7 @@ FReply UWidgetStudioButtonBase::NativeOnMouseButtonUp(const FGeometry& InGeometr
 {
 	Super::NativeOnMouseButtonUp(InGeometry, InMouseEvent);
 	bIsPressed = false;
+	MarkAnimationTargetsDirty();
 	OnReleased.Broadcast(this);
 	return FReply::Handled();
 }
@@ -85,6 +87,7 @@ void UWidgetStudioButtonBase::SetCheckable(const bool bNewCheckableState)
 	{
 		bIsCheckable = bNewCheckableState;
 	}
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioButtonBase::SetChecked(const bool bNewCheckedState, const bool bBroadcast)
@@ -102,11 +105,13 @@ void UWidgetStudioButtonBase::SetChecked(const bool bNewCheckedState, const bool
 			OnToggled.Broadcast(this, IsChecked());
 		}
 	}
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioButtonBase::SetCheckedLockedState(const bool bNewCheckedState)
 {
 	bIsCheckedStateLocked = bNewCheckedState;
+	MarkAnimationTargetsDirty();
 }
 
 bool UWidgetStudioButtonBase::IsCheckable() const
@@ -128,3 +133,8 @@ bool UWidgetStudioButtonBase::IsPressed() const
 {
 	return bIsPressed;
 }
+
+bool UWidgetStudioButtonBase::HasAnimationPriority() const
+{
+	return bIsPressed || Super::HasAnimationPriority();
+}
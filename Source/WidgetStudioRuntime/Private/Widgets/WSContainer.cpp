@@ -8,8 +8,56 @@
 */
 
 #include "Widgets/WSContainer.h"
+#include "WidgetStudioRuntime.h"
 
-void UWidgetStudioContainer::ConstructOption(FButtonOptions Option)
+/** Returns true if every option has a key and no two options share one. */
+static bool HasUniqueKeys(const TArray<FButtonOptions>& InOptions)
+{
+	TSet<FName> Keys;
+	Keys.Reserve(InOptions.Num());
+	for (const FButtonOptions& Option : InOptions)
+	{
+		bool bIsAlreadyInSet = false;
+		Keys.Add(Option.Key, &bIsAlreadyInSet);
+		if (Option.Key.IsNone() || bIsAlreadyInSet)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void UWidgetStudioContainer::ConstructOption(const FButtonOptions& Option)
+{
+	// Override in child class
+}
+
+void UWidgetStudioContainer::OnOptionsChanging()
+{
+	// Override in child class
+}
+
+void UWidgetStudioContainer::OnOptionInserted(int32 Index)
+{
+	// Override in child class
+}
+
+void UWidgetStudioContainer::OnOptionRemoved(int32 Index)
+{
+	// Override in child class
+}
+
+void UWidgetStudioContainer::OnOptionMoved(int32 FromIndex, int32 ToIndex)
+{
+	// Override in child class
+}
+
+void UWidgetStudioContainer::OnOptionUpdated(int32 Index)
+{
+	// Override in child class
+}
+
+void UWidgetStudioContainer::OnOptionsChanged()
 {
 	// Override in child class
 }
@@ -31,19 +79,29 @@ int32 UWidgetStudioContainer::GetCurrentIndex() const
 
 int32 UWidgetStudioContainer::GetOptionCount() const
 {
-	return Options.Num();
+	return GetOptionsView().Num();
 }
 
 TArray<FButtonOptions> UWidgetStudioContainer::GetOptions() const
 {
+	return TArray<FButtonOptions>(GetOptionsView());
+}
+
+TConstArrayView<FButtonOptions> UWidgetStudioContainer::GetOptionsView() const
+{
+	if (const UWidgetStudioContainer* Source = OptionsSource.Get())
+	{
+		return Source->GetOptionsView();
+	}
 	return Options;
 }
 
 FButtonOptions UWidgetStudioContainer::GetOptionAtIndex(const int32 Index)
 {
-	if (Options.IsValidIndex(Index))
+	const TConstArrayView<FButtonOptions> OptionsView = GetOptionsView();
+	if (OptionsView.IsValidIndex(Index))
 	{
-		return Options[Index];
+		return OptionsView[Index];
 	}
 
 	return FButtonOptions();
@@ -51,18 +109,21 @@ FButtonOptions UWidgetStudioContainer::GetOptionAtIndex(const int32 Index)
 
 FButtonOptions UWidgetStudioContainer::GetCurrentOption() const
 {
-	if (Options.IsValidIndex(CurrentIndex))
+	const TConstArrayView<FButtonOptions> OptionsView = GetOptionsView();
+	if (OptionsView.IsValidIndex(CurrentIndex))
 	{
-		return Options[CurrentIndex];
+		return OptionsView[CurrentIndex];
 	}
 	return FButtonOptions();
 }
 
 int32 UWidgetStudioContainer::GetOptionIndexViaText(const FText InText)
 {
-	for (int32 i = 0; i < Options.Num(); i++)
+	const TConstArrayView<FButtonOptions> OptionsView = GetOptionsView();
+	const FString& InString = InText.ToString();
+	for (int32 i = 0; i < OptionsView.Num(); i++)
 	{
-		if (Options[i].Text.ToString().ToLower() == InText.ToString().ToLower())
+		if (OptionsView[i].Text.ToString().Equals(InString, ESearchCase::IgnoreCase))
 		{
 			return i;
 		}
@@ -73,12 +134,12 @@ int32 UWidgetStudioContainer::GetOptionIndexViaText(const FText InText)
 
 void UWidgetStudioContainer::IncrementCurrentIndex(const bool bBroadcast)
 {
-	SetCurrentIndex(FMath::Clamp(CurrentIndex + 1, 0, Options.Num()), bBroadcast);
+	SetCurrentIndex(FMath::Clamp(CurrentIndex + 1, 0, GetOptionCount()), bBroadcast);
 }
 
 void UWidgetStudioContainer::DecrementCurrentIndex(const bool bBroadcast)
 {
-	SetCurrentIndex(FMath::Clamp(CurrentIndex - 1, 0, Options.Num()), bBroadcast);
+	SetCurrentIndex(FMath::Clamp(CurrentIndex - 1, 0, GetOptionCount()), bBroadcast);
 }
 
 void UWidgetStudioContainer::ClearCurrentIndex(const bool bBroadcast)
@@ -86,25 +147,186 @@ void UWidgetStudioContainer::ClearCurrentIndex(const bool bBroadcast)
 	SetCurrentIndex(-1, bBroadcast);
 }
 
-void UWidgetStudioContainer::SetOptions(const TArray<FButtonOptions> NewOptions)
+void UWidgetStudioContainer::SetOptions(TArray<FButtonOptions> NewOptions)
+{
+	// Diff against the options that were read from the source, so the ones that stay are not rebuilt
+	ReleaseOptionsSource();
+
+	// Remember the selection, to broadcast when the current index or the selected option changes
+	const int32 PreviousIndex = CurrentIndex;
+	const FButtonOptions PreviousOption = Options.IsValidIndex(CurrentIndex) ? Options[CurrentIndex] : FButtonOptions();
+
+	OnOptionsChanging();
+
+	if (HasUniqueKeys(Options) && HasUniqueKeys(NewOptions))
+	{
+		// The current index follows the selected option
+		const FName SelectedKey = PreviousOption.Key;
+
+		ReconcileOptionsByKey(MoveTemp(NewOptions));
+
+		CurrentIndex = -1;
+		for (int32 i = 0; i < Options.Num() && !SelectedKey.IsNone(); i++)
+		{
+			if (Options[i].Key == SelectedKey)
+			{
+				CurrentIndex = i;
+				break;
+			}
+		}
+	}
+	else
+	{
+		ReconcileOptionsByPosition(MoveTemp(NewOptions));
+
+		if (!Options.IsValidIndex(CurrentIndex))
+		{
+			CurrentIndex = -1;
+		}
+	}
+
+	OnOptionsChanged();
+	MarkAnimationTargetsDirty();
+
+	if (CurrentIndex != PreviousIndex || (Options.IsValidIndex(CurrentIndex) && !Options[CurrentIndex].IsIdentical(PreviousOption)))
+	{
+		OnCurrentIndexChanged.Broadcast(CurrentIndex, Options.IsValidIndex(CurrentIndex) ? Options[CurrentIndex] : FButtonOptions());
+	}
+}
+
+void UWidgetStudioContainer::ReconcileOptionsByPosition(TArray<FButtonOptions>&& NewOptions)
 {
-	ClearOptions();
-	Options = NewOptions;
+	const int32 SharedCount = FMath::Min(Options.Num(), NewOptions.Num());
+	for (int32 i = 0; i < SharedCount; i++)
+	{
+		if (!Options[i].IsIdentical(NewOptions[i]))
+		{
+			Options[i] = MoveTemp(NewOptions[i]);
+			OnOptionUpdated(i);
+		}
+	}
 
+	// Remove from the end so the remaining indices stay valid
+	for (int32 i = Options.Num() - 1; i >= NewOptions.Num(); i--)
+	{
+		Options.RemoveAt(i);
+		OnOptionRemoved(i);
+	}
+
+	Options.Reserve(NewOptions.Num());
+	for (int32 i = Options.Num(); i < NewOptions.Num(); i++)
+	{
+		Options.Add(MoveTemp(NewOptions[i]));
+		OnOptionInserted(i);
+	}
+}
+
+void UWidgetStudioContainer::ReconcileOptionsByKey(TArray<FButtonOptions>&& NewOptions)
+{
+	TMap<FName, int32> PreviousIndices;
+	PreviousIndices.Reserve(Options.Num());
 	for (int32 i = 0; i < Options.Num(); i++)
 	{
-		ConstructOption(Options[i]);
+		PreviousIndices.Add(Options[i].Key, i);
+	}
+
+	// Find where every new option was, if it was there at all
+	TArray<int32> FromIndices;
+	FromIndices.SetNumUninitialized(NewOptions.Num());
+	TBitArray<> IsKept(false, Options.Num());
+	for (int32 i = 0; i < NewOptions.Num(); i++)
+	{
+		const int32* FromIndex = PreviousIndices.Find(NewOptions[i].Key);
+		FromIndices[i] = FromIndex ? *FromIndex : INDEX_NONE;
+		if (FromIndex)
+		{
+			IsKept[*FromIndex] = true;
+		}
+	}
+
+	for (int32 i = Options.Num() - 1; i >= 0; i--)
+	{
+		if (!IsKept[i])
+		{
+			OnOptionRemoved(i);
+		}
+	}
+
+	// Build the new order in one pass, moving the kept options over rather than shifting them around
+	TArray<FButtonOptions> PreviousOptions = MoveTemp(Options);
+	Options.Reset(NewOptions.Num());
+	for (int32 Target = 0; Target < NewOptions.Num(); Target++)
+	{
+		const int32 FromIndex = FromIndices[Target];
+		if (FromIndex == INDEX_NONE)
+		{
+			Options.Add(MoveTemp(NewOptions[Target]));
+			OnOptionInserted(Target);
+			continue;
+		}
+
+		Options.Add(MoveTemp(PreviousOptions[FromIndex]));
+		if (FromIndex != Target)
+		{
+			OnOptionMoved(FromIndex, Target);
+		}
+
+		if (!Options[Target].IsIdentical(NewOptions[Target]))
+		{
+			Options[Target] = MoveTemp(NewOptions[Target]);
+			OnOptionUpdated(Target);
+		}
+	}
+}
+
+void UWidgetStudioContainer::ReleaseOptionsSource()
+{
+	if (const UWidgetStudioContainer* Source = OptionsSource.Get())
+	{
+		Options = TArray<FButtonOptions>(Source->GetOptionsView());
 	}
+	OptionsSource.Reset();
+}
+
+void UWidgetStudioContainer::SetOptionsSource(const UWidgetStudioContainer* Source)
+{
+	// Reading from a container that ends up reading from this one would never end
+	for (const UWidgetStudioContainer* Link = Source; Link; Link = Link->OptionsSource.Get())
+	{
+		if (Link == this)
+		{
+			UE_LOG(LogWidgetStudio, Warning, TEXT("%s can't read its options from %s, the options would be read in a loop"), *GetName(), *Source->GetName());
+			return;
+		}
+	}
+
+	if (Source)
+	{
+		// The options are only read from the source, so don't keep a copy around
+		OptionsSource = Source;
+		Options.Empty();
+	}
+	else
+	{
+		ReleaseOptionsSource();
+	}
+
+	if (!GetOptionsView().IsValidIndex(CurrentIndex))
+	{
+		CurrentIndex = -1;
+	}
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioContainer::SetCurrentIndex(const int32 Index, const bool bBroadcast)
 {
-	if (Index > -1 && Index < Options.Num())
+	const TConstArrayView<FButtonOptions> OptionsView = GetOptionsView();
+	if (Index > -1 && Index < OptionsView.Num())
 	{
 		CurrentIndex = Index;
 		if (bBroadcast)
 		{
-			OnCurrentIndexChanged.Broadcast(CurrentIndex, Options[CurrentIndex]);
+			OnCurrentIndexChanged.Broadcast(CurrentIndex, OptionsView[CurrentIndex]);
 		}
 	}
 	else
@@ -115,25 +337,32 @@ void UWidgetStudioContainer::SetCurrentIndex(const int32 Index, const bool bBroa
 			OnCurrentIndexChanged.Broadcast(CurrentIndex, FButtonOptions());
 		}
 	}
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioContainer::AddOption(const FButtonOptions NewOption)
 {
+	ReleaseOptionsSource();
 	Options.Add(NewOption);
-	ConstructOption(NewOption);
+	ConstructOption(Options.Last());
+	MarkAnimationTargetsDirty();
 }
 
 void UWidgetStudioContainer::ClearOptions()
 {
+	OptionsSource.Reset();
 	Options.Empty();
 	CurrentIndex = -1;
+	MarkAnimationTargetsDirty();
 }
 
 bool UWidgetStudioContainer::SetCurrentIndexViaOptionText(const FText InText, const bool bBroadcast)
 {
-	for (int32 i = 0; i < Options.Num(); i++)
+	const TConstArrayView<FButtonOptions> OptionsView = GetOptionsView();
+	const FString& InString = InText.ToString();
+	for (int32 i = 0; i < OptionsView.Num(); i++)
 	{
-		if (Options[i].Text.ToString().ToLower() == InText.ToString().ToLower())
+		if (OptionsView[i].Text.ToString().Equals(InString, ESearchCase::IgnoreCase))
 		{
 			SetCurrentIndex(i, bBroadcast);
 			return true;
@@ -128,4 +128,5 @@ void UWidgetStudioTextFieldBase::SetFilter(const ETextFilter NewFilter)
 void UWidgetStudioTextFieldBase::SetState(const ETextFieldState NewState)
 {
 	State = NewState;
+	MarkAnimationTargetsDirty();
 }
@@ -289,4 +289,8 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "IconSet")
 		UTexture2D* Moon;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
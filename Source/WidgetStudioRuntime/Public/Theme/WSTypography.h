@@ -84,6 +84,17 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Typography")
 	FFontStyle Overline;
+
+	/**
+	* Get the type scale for a font type
+	* @param FontType - the font type to look up
+	* @return the matching FFontStyle, or a default FFontStyle for Custom
+	*/
+	FFontStyle GetTypeScale(EWSFontType FontType) const;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
 
 
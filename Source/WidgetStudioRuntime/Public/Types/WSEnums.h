@@ -209,6 +209,8 @@ enum class EIconItem : uint8
 	ListView				UMETA(DisplayName = "List View"),
 	Sun						UMETA(DisplayName = "Sun"),
 	Moon					UMETA(DisplayName = "Moon"),
+
+	IconItem_Max			UMETA(Hidden)
 };
 
 UENUM(BlueprintType)
@@ -230,3 +232,42 @@ enum class EWSPlacement : uint8
 
 	Placement_Max		UMETA(Hidden),
 };
+
+UENUM(Blueprintable, BlueprintType, META=(Tooltip = "The shared materials used by Widget Studio controls."))
+enum class EWSMaterial : uint8
+{
+	RoundedSquare				UMETA(DisplayName="Rounded Square"),
+	RoundedSquareOutline		UMETA(DisplayName="Rounded Square Outline"),
+	RoundedDropShadow			UMETA(DisplayName="Rounded Drop Shadow"),
+	RoundedDropShadowOutline	UMETA(DisplayName="Rounded Drop Shadow Outline"),
+	RadialBar					UMETA(DisplayName="Radial Bar"),
+
+	Material_Max				UMETA(Hidden),
+};
+
+UENUM(BlueprintType, META=(Tooltip = "The curve Widget Studio animations follow."))
+enum class EWSEasing : uint8
+{
+	Exponential					UMETA(DisplayName="Exponential", ToolTip="Approach the target at the animation speed."),
+	Linear						UMETA(DisplayName="Linear"),
+	Cubic						UMETA(DisplayName="Cubic"),
+	Quint						UMETA(DisplayName="Quint"),
+	Back						UMETA(DisplayName="Back", ToolTip="Overshoot the target slightly before settling on it."),
+	Spring						UMETA(DisplayName="Spring", ToolTip="Oscillate around the target before settling on it."),
+
+	Easing_Max					UMETA(Hidden),
+};
+
+UENUM(BlueprintType, META=(Bitflags, UseEnumValuesAsMaskValuesInEditor="true", Tooltip = "The parts of the Widget Studio style that changed."))
+enum class EWSStyleChange : uint8
+{
+	None						= 0 UMETA(Hidden),
+	Palette						= 1 << 0 UMETA(DisplayName="Palette"),
+	Typography					= 1 << 1 UMETA(DisplayName="Typography"),
+	IconSet						= 1 << 2 UMETA(DisplayName="Icon Set"),
+	BorderRadius				= 1 << 3 UMETA(DisplayName="Border Radius"),
+	Dimensions					= 1 << 4 UMETA(DisplayName="Dimensions"),
+
+	All							= Palette | Typography | IconSet | BorderRadius | Dimensions UMETA(Hidden),
+};
+ENUM_CLASS_FLAGS(EWSStyleChange);
@@ -0,0 +1,96 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnWidgetStudioAnimationClockTick, float /* DeltaTime */);
+
+/**
+ * The clock Widget Studio animations run on. It is driven by the Slate application delta time, so it keeps running
+ * while the world is paused or dilated and for widgets without a world. It steps at most WidgetStudio.AnimationRate
+ * times per second, passing on the time of the frames in between, and only runs while something listens to it.
+ */
+class WIDGETSTUDIORUNTIME_API FWidgetStudioAnimationClock
+{
+
+public:
+
+	/** Create the clock */
+	static void Initialize();
+
+	/** Destroy the clock */
+	static void Shutdown();
+
+	/**
+	* Get the clock instance
+	* @pre Initialize has been called by the runtime module
+	* @return the clock
+	*/
+	static FWidgetStudioAnimationClock& Get();
+
+	/**
+	* Call a function on every step of the clock, starting the clock if it is stopped
+	* @param Delegate - the function to call with the time since the previous step
+	* @return the handle to remove the listener with
+	*/
+	FDelegateHandle AddListener(FOnWidgetStudioAnimationClockTick::FDelegate&& Delegate);
+
+	/**
+	* Stop calling a function on every step of the clock, stopping the clock once it has no listeners left
+	* @param Handle - the handle returned by AddListener
+	*/
+	void RemoveListener(FDelegateHandle Handle);
+
+	/**
+	* Get the time between the last two steps of the clock
+	* @return the delta time in seconds
+	*/
+	float GetDeltaTime() const
+	{
+		return DeltaTime;
+	}
+
+	~FWidgetStudioAnimationClock();
+
+private:
+
+	FWidgetStudioAnimationClock() = default;
+
+	/** Follow the Slate application tick, or the core ticker where Slate is not initialized */
+	void Start();
+
+	void Stop();
+
+	/**
+	 * Accumulate the time of a frame, stepping the clock once the update interval is reached
+	 * @param FrameDeltaTime - time since the last frame
+	 */
+	void Advance(float FrameDeltaTime);
+
+	FOnWidgetStudioAnimationClockTick OnTick;
+
+	/* Frame time accumulated since the last step */
+	float AccumulatedTime = 0.f;
+
+	float DeltaTime = 0.f;
+
+	FDelegateHandle SlateTickHandle;
+
+#if ENGINE_MAJOR_VERSION == 4
+	FDelegateHandle TickerHandle;
+#else
+	FTSTicker::FDelegateHandle TickerHandle;
+#endif
+
+	static TUniquePtr<FWidgetStudioAnimationClock> Instance;
+};
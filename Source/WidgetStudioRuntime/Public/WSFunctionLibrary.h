@@ -15,6 +15,7 @@
 #include "Components/PanelWidget.h"
 #include "Components/SizeBox.h"
 #include "Components/TextBlock.h"
+#include "Engine/LatentActionManager.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Theme/WSIconSet.h"
 #include "Theme/WSTheme.h"
@@ -39,6 +40,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Widget Studio|Function Library|Color")
 	static FLinearColor GetColorFromPalette(EPalette Color);
 
+	/** Returns the FLinearColor values of the given Palette Colors, resolved in a single pass.
+	* @return TArray<FLinearColor> in the same order as Colors
+	*/
+	UFUNCTION(BlueprintPure, Category = "Widget Studio|Function Library|Color")
+	static TArray<FLinearColor> GetColorsFromPalette(const TArray<EPalette>& Colors);
+
 	/** Returns friendly to hostile color based on the value given. The default color order is --- [0] Friendly -> Warning -> Error [1]
 	 * @param ValuePercent The 0 - 1 value in which to grade the color value.
 	 * @param bReverseOrder Reverses the color order. If set to true, the order will be [0] Error -> Warning -> Friendly [1]
@@ -123,6 +130,30 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Widget Studio|Function Library|Style")
 	static bool SetIconSet(const TSoftObjectPtr<UWidgetStudioIconSet> NewIconSet);
 
+	/** Asynchronously loads and applies the theme, keeping the current theme active until the new one is resident.
+	* Completes once the theme is applied. bSuccess is false if the theme is invalid or a newer request replaced it.
+	* @param NewTheme - the Theme to set
+	* @param Priority - async loading priority, higher values are loaded first
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Function Library|Style", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void SetThemeAsync(UObject* WorldContextObject, TSoftObjectPtr<UWidgetStudioTheme> NewTheme, int32 Priority, bool& bSuccess, FLatentActionInfo LatentInfo);
+
+	/** Asynchronously loads and applies the typography, keeping the current typography active until the new one is resident.
+	* Completes once the typography is applied. bSuccess is false if the typography is invalid or a newer request replaced it.
+	* @param NewTypography - the Typography to set
+	* @param Priority - async loading priority, higher values are loaded first
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Function Library|Style", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void SetTypographyAsync(UObject* WorldContextObject, TSoftObjectPtr<UWidgetStudioTypography> NewTypography, int32 Priority, bool& bSuccess, FLatentActionInfo LatentInfo);
+
+	/** Asynchronously loads and applies the icon set, keeping the current icon set active until all of its textures are resident.
+	* Completes once the icon set is applied. bSuccess is false if the icon set is invalid or a newer request replaced it.
+	* @param NewIconSet - the IconSet to set
+	* @param Priority - async loading priority, higher values are loaded first
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Function Library|Style", Meta = (Latent, LatentInfo = "LatentInfo", WorldContext = "WorldContextObject"))
+	static void SetIconSetAsync(UObject* WorldContextObject, TSoftObjectPtr<UWidgetStudioIconSet> NewIconSet, int32 Priority, bool& bSuccess, FLatentActionInfo LatentInfo);
+
 	/**
 	 * Returns the Widget Studio stylized slate brush.
 	 * @return A rounded slate brush styled by Widget Studio.
@@ -146,7 +177,11 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Function Library|Style")
 	static void SetBrushImageSize(UImage* Image, float NewWidth, float NewHeight);
 	
-	/* Animation */
+	/*
+	 * Animation
+	 * - The Interp functions set the target of a tween run by the Widget Studio tween scheduler.
+	 * - Calling them again with the same target is cheap, only properties that are still moving cost anything per frame.
+	 */
 	
 	/** Smoothly interpolate the widget's color and opacity. Setting Speed to 0 will skip the interp. */
 	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Function Library|Animation")
@@ -191,6 +226,20 @@ public:
 	/** Smoothly interpolate the brush image size. Setting Speed to 0 will skip the interp. */
 	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Function Library|Animation")
 	static void InterpBrushImageSize(UImage* Image, float TargetWidth, float TargetHeight, float Speed);
+
+	/**
+	 * Resize the size box in one step, and smoothly scale it from its previous size with a render transform.
+	 * Only paint is invalidated while it animates. Zero targets leave the current override in place.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Function Library|Animation")
+	static void InterpSizeBoxOverridesWithScale(USizeBox* Widget, float TargetWidth, float TargetHeight, float Speed);
+
+	/**
+	 * Resize the brush image in one step, and smoothly scale it from its previous size with a render transform.
+	 * Only paint is invalidated while it animates.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Function Library|Animation")
+	static void InterpBrushImageSizeWithScale(UImage* Image, float TargetWidth, float TargetHeight, float Speed);
 	
 
 	/* Material */
@@ -207,6 +256,47 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Widget Studio|Function Library|Material")
 	static UMaterialInterface* GetRoundedShadowMaterial();
 
+	/** Return a reference to one of the shared Widget Studio materials */
+	UFUNCTION(BlueprintPure, Category = "Widget Studio|Function Library|Material")
+	static UMaterialInterface* GetWidgetStudioMaterial(EWSMaterial Material);
+
+	/** Take a pooled dynamic instance of a shared material. Return it with ReleaseDynamicMaterial when done. */
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Function Library|Material")
+	static UMaterialInstanceDynamic* AcquireDynamicMaterial(EWSMaterial Material);
+
+	/** Return a dynamic material instance obtained with AcquireDynamicMaterial to the pool */
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Function Library|Material")
+	static void ReleaseDynamicMaterial(UMaterialInstanceDynamic* DynamicMaterial);
+
+
+	/* Scalability */
+
+	/**
+	 * Return the Widget Studio quality level, set through the sg.WidgetStudioQuality scalability group.
+	 * - Low (0): no drop shadows, every animation snaps.
+	 * - Medium (1): no drop shadows, only color and opacity fades animate.
+	 * - High (2) and Epic (3): every effect is enabled.
+	 * Projects can tune each tier with the bDropShadows, bAnimateFades and bAnimateMotion keys of the
+	 * [WidgetStudioQuality@<Level>] sections in their scalability ini.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Widget Studio|Function Library|Scalability")
+	static int32 GetQualityLevel();
+
+	/**
+	 * Return true if widgets construct and paint their drop shadows at the current quality level.
+	 * Widgets constructed while shadows are disabled have none until they are rebuilt.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Widget Studio|Function Library|Scalability")
+	static bool AreDropShadowsEnabled();
+
+	/** Return true if color and opacity changes animate at the current quality level */
+	UFUNCTION(BlueprintPure, Category = "Widget Studio|Function Library|Scalability")
+	static bool AreFadesAnimated();
+
+	/** Return true if translation, scale, rotation and size changes animate at the current quality level */
+	UFUNCTION(BlueprintPure, Category = "Widget Studio|Function Library|Scalability")
+	static bool IsMotionAnimated();
+
 	
 	/* Typography */
 
@@ -226,6 +316,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Function Library|Typography")
 	static FSlateFontInfo ConstructFontInfoFromTypography(const EWSFontType FontType);
 
+	/** Returns the prebuilt Font Info of a Typography type, scaled by the size modifier */
+	UFUNCTION(BlueprintPure, Category = "Widget Studio|Function Library|Typography")
+	static FSlateFontInfo GetFontInfoFromTypography(const EWSFontType FontType, const ESizeModifier Modifier);
+
 	/** Create Font Info */
 	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Function Library|Typography")
 	static FSlateFontInfo ConstructFontInfoFromStyle(const FFontStyle FontStyle);
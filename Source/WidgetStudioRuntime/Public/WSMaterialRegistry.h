@@ -0,0 +1,85 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "UObject/GCObject.h"
+#include "Types/WSEnums.h"
+
+class UMaterialInterface;
+class UMaterialInstanceDynamic;
+
+/**
+ * Keeps the shared Widget Studio materials loaded and referenced for the lifetime of the runtime module, so widgets
+ * never resolve them by path while styling. Also pools dynamic material instances for widgets that need per-instance
+ * parameters.
+ */
+class WIDGETSTUDIORUNTIME_API FWidgetStudioMaterialRegistry : public FGCObject
+{
+
+public:
+
+	/** Create the registry, materials are loaded once the engine has finished initializing */
+	static void Initialize();
+
+	/** Destroy the registry, releasing all materials and pooled instances */
+	static void Shutdown();
+
+	/**
+	* Get the registry instance
+	* @pre Initialize has been called by the runtime module
+	* @return the registry
+	*/
+	static FWidgetStudioMaterialRegistry& Get();
+
+	/**
+	* Get a shared material, loading it if it has not been loaded yet
+	* @param Material - the material to retrieve
+	* @return the material, or nullptr for an invalid entry
+	*/
+	UMaterialInterface* GetMaterial(EWSMaterial Material);
+
+	/**
+	* Take a dynamic instance of a shared material from the pool, creating one if the pool is empty.
+	* Parameters of a recycled instance are reset to the parent material defaults.
+	* @param Material - the parent material of the instance
+	* @return the dynamic material instance, or nullptr if the material is unavailable
+	*/
+	UMaterialInstanceDynamic* AcquireDynamicMaterial(EWSMaterial Material);
+
+	/**
+	* Return a dynamic instance obtained through AcquireDynamicMaterial to the pool
+	* @param DynamicMaterial - the instance to recycle, must no longer be used by the caller
+	*/
+	void ReleaseDynamicMaterial(UMaterialInstanceDynamic* DynamicMaterial);
+
+	// Begin FGCObject
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override;
+	// End FGCObject
+
+private:
+
+	static constexpr int32 MaterialCount = static_cast<int32>(EWSMaterial::Material_Max);
+
+	FWidgetStudioMaterialRegistry();
+	
+	/** Load every shared material that is not loaded yet */
+	void LoadMaterials();
+
+	TStaticArray<UMaterialInterface*, MaterialCount> Materials;
+
+	TStaticArray<TArray<UMaterialInstanceDynamic*>, MaterialCount> DynamicMaterialPools;
+
+	FDelegateHandle PostEngineInitHandle;
+
+	static TUniquePtr<FWidgetStudioMaterialRegistry> Instance;
+};
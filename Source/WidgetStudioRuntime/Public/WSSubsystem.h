@@ -1,4 +1,4 @@
-/* 
+﻿/* 
 * Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
 *
 * Website: https://widgetstudio.design
@@ -14,6 +14,11 @@
 /* used for log category - do not remove */
 #include "WidgetStudioRuntime.h"
 
+#include "Async/Future.h"
+#include "Containers/StaticArray.h"
+#include "Containers/Ticker.h"
+#include "Engine/StreamableManager.h"
+#include "Fonts/SlateFontInfo.h"
 #include "Subsystems/EngineSubsystem.h"
 #include "Theme/WSIconSet.h"
 #include "Theme/WSTheme.h"
@@ -24,10 +29,36 @@ extern int32 DefaultBorderRadius;
 extern float DefaultIdealWidth;
 extern float DefaultIdealHeight;
 
+/**
+ * Style values read by every widget on every paint -- kept together in a single cache line and only written by the
+ * subsystem when the corresponding setting changes
+ */
+struct alignas(PLATFORM_CACHE_LINE_SIZE) FWidgetStudioStyleConstants
+{
+	int32 BorderRadius = 0;
+	float IdealWidth = 0;
+	float IdealHeight = 0;
+
+	/* Scale per ESizeModifier, with a trailing identity scale for invalid modifiers */
+	float SizeModifierScales[static_cast<int32>(ESizeModifier::SizeModifier_Max) + 1] = { 0.55f, 0.7f, 0.85f, 1.f, 1.15f, 1.3f, 1.45f, 1.6f, 1.f };
+
+	FORCEINLINE float GetSizeModifierScale(const ESizeModifier Modifier) const
+	{
+		return SizeModifierScales[FMath::Min(static_cast<int32>(Modifier), static_cast<int32>(ESizeModifier::SizeModifier_Max))];
+	}
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FStyleDelegate);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FStyleChangeDelegate, int32, StyleChanges);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnStyleChangedNative, EWSStyleChange /* StyleChanges */);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FRestyleProgressDelegate, int32, RestyledWidgets, int32, TotalWidgets);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FStyleLoadDelegate, bool, bSuccess);
+DECLARE_DELEGATE_OneParam(FOnStyleLoaded, bool /* bSuccess */);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FStartInitDelegate);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FEndInitDelegate);
 
+class UWidgetStudioBase;
+
 //To access:  UWidgetStudioSubsystem* WidgetStudio = GEngine->GetEngineSubsystem<UWidgetStudioSubsystem>();
 
 /**
@@ -64,6 +95,21 @@ public:
 	UPROPERTY(BlueprintAssignable, BlueprintReadWrite, BlueprintCallable, Category = "Widget Studio|Events")
 	FStyleDelegate OnStyleChanged;
 
+	/* Broadcast along with OnStyleChanged, StyleChanges is a bitmask of EWSStyleChange naming what changed */
+	UPROPERTY(BlueprintAssignable, BlueprintReadWrite, BlueprintCallable, Category = "Widget Studio|Events")
+	FStyleChangeDelegate OnStyleChangedWithMask;
+
+	/* Native version of OnStyleChangedWithMask for C++ listeners */
+	FOnStyleChangedNative OnStyleChangedNative;
+
+	/* Broadcast every frame while on-screen widgets are restyled after a style change */
+	UPROPERTY(BlueprintAssignable, BlueprintReadWrite, BlueprintCallable, Category = "Widget Studio|Events")
+	FRestyleProgressDelegate OnRestyleProgress;
+
+	/* Broadcast once every on-screen widget has been restyled after a style change */
+	UPROPERTY(BlueprintAssignable, BlueprintReadWrite, BlueprintCallable, Category = "Widget Studio|Events")
+	FStyleDelegate OnRestyleComplete;
+
 	UPROPERTY(BlueprintAssignable, BlueprintReadWrite, BlueprintCallable, Category = "Widget Studio|Inititalization")
 	FStartInitDelegate OnPluginStartedInit;
 
@@ -73,26 +119,35 @@ public:
 	// Begin BP Interface
 
 	/**
-	* Make sure current Theme DataAsset is loaded and valid, then retrieve it
+	* Retrieve the currently active Theme DataAsset, falling back to the default theme if none is resolved
 	* @return the UWidgetStudioTheme*
 	*/
 	UFUNCTION(BlueprintPure, Category = "Widget Studio|Style")
 	UWidgetStudioTheme *GetTheme();
 
 	/**
-	* Make sure current IconSet DataAsset is loaded and valid, then retrieve it
+	* Retrieve the currently active IconSet DataAsset, falling back to the default icon set if none is resolved
 	* @return the UWidgetStudioIconSet*
 	*/
 	UFUNCTION(BlueprintPure, Category = "Widget Studio|Style")
 	UWidgetStudioIconSet *GetIconSet();
 
 	/**
-	* Make sure current Typography DataAsset is loaded and valid, then retrieve it
+	* Retrieve the currently active Typography DataAsset, falling back to the default typography if none is resolved
 	* @return the UWidgetStudioTypography*
 	*/
 	UFUNCTION(BlueprintPure, Category = "Widget Studio|Style")
 	UWidgetStudioTypography *GetTypography();
 
+	/**
+	* Get the style constants (border radius, ideal dimensions and size modifier scales) without any config access
+	* @return the FWidgetStudioStyleConstants
+	*/
+	static FORCEINLINE const FWidgetStudioStyleConstants& GetStyleConstants()
+	{
+		return StyleConstants;
+	}
+
 	/**
 	* Get current border radius value
 	* @return BorderRadius
@@ -109,7 +164,7 @@ public:
 
 	/**
 	* Sets the theme (colors) for widgets -- checks to make sure the incoming Theme is valid and loaded, then updates
-	* the current Theme, including the "Theme" value in the .ini file. Broadcasts OnStyleChanged() event.
+	* the current Theme and saves the "Theme" setting. Broadcasts OnStyleChanged() event, unless a style edit is open.
 	* @pre Theme passed in must point to a valid data asset
 	* @post Passed in Theme data asset will be loaded (if not already) and applied as the global theme
 	* @post OnStyleChanged event will be broadcast, so Editor module WS Settings are updated
@@ -121,7 +176,7 @@ public:
 
 	/**
 	* Sets the IconStyle for widgets -- checks to make sure the incoming IconSet is valid and loaded, then updates
-	* the current IconSet, including the "IconSet" value in the .ini file. Broadcasts OnStyleChanged() event.
+	* the current IconSet and saves the "IconSet" setting. Broadcasts OnStyleChanged() event, unless a style edit is open.
 	* @pre IconSet passed in must point to a valid data asset
 	* @post Passed in IconSet data asset will be loaded (if not already) and applied as the global icon set
 	* @post OnStyleChanged event will be broadcast, so Editor module WS Settings are updated
@@ -133,7 +188,7 @@ public:
 
 	/**
 	* Sets the typography (font settings) for widgets -- checks to make sure the incoming Typography is valid and loaded, then updates
-	* the current Typography, including the "Typography" value in the .ini file. Broadcasts OnStyleChanged() event.
+	* the current Typography and saves the "Typography" setting. Broadcasts OnStyleChanged() event, unless a style edit is open.
 	* @pre Typography passed in must point to a valid data asset
 	* @post Passed in Typography data asset will be loaded (if not already) and applied as the global typography
 	* @post OnStyleChanged event will be broadcast, so Editor module WS Settings are updated
@@ -144,8 +199,73 @@ public:
 	bool SetTypography(TSoftObjectPtr<UWidgetStudioTypography> InTypography);
 
 	/**
-	* Sets the border radius for widgets -- updates BorderRadius, oncluding "BorderRadius" value in the .ini file.
-	* Broadcasts OnStyleChanged() event.
+	* Asynchronously loads the Theme, then applies it like SetTheme. The current theme stays active while loading,
+	* and widgets restyle once, after the new theme is fully resident. If another request is made before this one
+	* finishes, async or through SetTheme, only the latest one is applied.
+	* @param InTheme - the Theme to set
+	* @param OnCompleted - called with true once the theme is applied, false if it is invalid or was superseded
+	* @param Priority - async loading priority, higher values are loaded first
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Style", Meta = (AutoCreateRefTerm = "OnCompleted"))
+	void SetThemeAsync(TSoftObjectPtr<UWidgetStudioTheme> InTheme, const FStyleLoadDelegate& OnCompleted, int32 Priority = 0);
+
+	/**
+	* Asynchronously loads the IconSet, including all of its textures, then applies it like SetIconSet.
+	* @see SetThemeAsync
+	* @param InIconSet - the IconSet to set
+	* @param OnCompleted - called with true once the icon set is applied, false if it is invalid or was superseded
+	* @param Priority - async loading priority, higher values are loaded first
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Style", Meta = (AutoCreateRefTerm = "OnCompleted"))
+	void SetIconSetAsync(TSoftObjectPtr<UWidgetStudioIconSet> InIconSet, const FStyleLoadDelegate& OnCompleted, int32 Priority = 0);
+
+	/**
+	* Asynchronously loads the Typography, including its typeface, then applies it like SetTypography.
+	* @see SetThemeAsync
+	* @param InTypography - the Typography to set
+	* @param OnCompleted - called with true once the typography is applied, false if it is invalid or was superseded
+	* @param Priority - async loading priority, higher values are loaded first
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Style", Meta = (AutoCreateRefTerm = "OnCompleted"))
+	void SetTypographyAsync(TSoftObjectPtr<UWidgetStudioTypography> InTypography, const FStyleLoadDelegate& OnCompleted, int32 Priority = 0);
+
+	/**
+	* Loads style assets in the background without applying them, e.g. during a loading screen, so a later
+	* Set*Async call completes immediately. The assets stay resident until the next call to PrefetchStyle.
+	* @param InTheme - the Theme to prefetch, may be null
+	* @param InIconSet - the IconSet to prefetch, may be null
+	* @param InTypography - the Typography to prefetch, may be null
+	* @param Priority - async loading priority, higher values are loaded first
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Style")
+	void PrefetchStyle(TSoftObjectPtr<UWidgetStudioTheme> InTheme, TSoftObjectPtr<UWidgetStudioIconSet> InIconSet, TSoftObjectPtr<UWidgetStudioTypography> InTypography, int32 Priority = 0);
+
+	/** Native version of SetThemeAsync */
+	void RequestThemeAsync(const TSoftObjectPtr<UWidgetStudioTheme>& InTheme, FOnStyleLoaded OnCompleted, int32 Priority = 0);
+
+	/** Native version of SetIconSetAsync */
+	void RequestIconSetAsync(const TSoftObjectPtr<UWidgetStudioIconSet>& InIconSet, FOnStyleLoaded OnCompleted, int32 Priority = 0);
+
+	/** Native version of SetTypographyAsync */
+	void RequestTypographyAsync(const TSoftObjectPtr<UWidgetStudioTypography>& InTypography, FOnStyleLoaded OnCompleted, int32 Priority = 0);
+
+	/**
+	* Start a batch of style changes. Setters called before the matching CommitStyleEdit apply their values right
+	* away, but OnStyleChanged is broadcast and the settings are saved only once, on commit. Edits can be nested.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Style")
+	void BeginStyleEdit();
+
+	/**
+	* Finish a batch of style changes started with BeginStyleEdit. Committing the outermost edit broadcasts
+	* OnStyleChanged once and saves all changed settings in a single write.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Style")
+	void CommitStyleEdit();
+
+	/**
+	* Sets the border radius for widgets -- updates BorderRadius and saves the "BorderRadius" setting.
+	* Broadcasts OnStyleChanged() event, unless a style edit is open.
 	* @param InRadius
 	* @return true if border radius is successfully set, false otherwise
 	*/
@@ -153,14 +273,112 @@ public:
 	bool SetBorderRadius(int32 InRadius);
 
 	/**
-	* Sets the control dimensions for widgets -- updates ControlDimensions, oncluding "ControlDimensions" value in the .ini file.
-	* Broadcasts OnStyleChanged() event.
+	* Sets the control dimensions for widgets -- updates ControlDimensions and saves the "ControlDimensions" setting.
+	* Broadcasts OnStyleChanged() event, unless a style edit is open.
 	* @param InDimensions
 	* @return true if control dimensions are successfully set, false otherwise
 	*/
 	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Style")
 	bool SetControlDimensions(FVector2D InDimensions);
 
+	/**
+	* Look up the resolved color of a palette entry. Theme colors are baked into the palette table every time
+	* OnStyleChanged is broadcast, so this is a single indexed load.
+	* @param Color - the palette entry to resolve
+	* @return the resolved color, or white for an invalid entry
+	*/
+	FORCEINLINE const FLinearColor& GetPaletteColor(const EPalette Color) const
+	{
+		return PaletteColors[FMath::Min(static_cast<int32>(Color), PaletteFallbackIndex)];
+	}
+
+	/**
+	* Look up the texture of an icon in the active icon set. The icon table is rebuilt by reflecting over the
+	* icon set's texture properties every time OnStyleChanged is broadcast, so this is a single indexed load.
+	* @param Icon - the icon to resolve
+	* @return the icon texture, or nullptr for an invalid entry or a missing icon set
+	*/
+	FORCEINLINE UTexture2D* GetIconTexture(const EIconItem Icon) const
+	{
+		const int32 Index = static_cast<int32>(Icon);
+		return Index < IconTextures.Num() ? IconTextures[Index] : nullptr;
+	}
+
+	/**
+	* Look up the prebuilt font info of a typography font type, scaled by a size modifier. The font matrix is
+	* rebuilt from the active typography every time OnStyleChanged is broadcast.
+	* @param FontType - the typography font type, Custom resolves to the default font style
+	* @param Modifier - the size modifier applied to the font size
+	* @return the ready to use FSlateFontInfo
+	*/
+	FORCEINLINE const FSlateFontInfo& GetFontInfo(const EWSFontType FontType, const ESizeModifier Modifier) const
+	{
+		const int32 TypeIndex = FMath::Min(static_cast<int32>(FontType), FontTypeCount - 1);
+		const int32 ModifierIndex = FMath::Min(static_cast<int32>(Modifier), FontModifierCount - 1);
+		return FontInfos[TypeIndex * FontModifierCount + ModifierIndex];
+	}
+
+	/**
+	* Get the typeface of the active typography, or the engine default font if there is none
+	* @return the UFont*
+	*/
+	UFont* GetTypeface() const
+	{
+		return ActiveTypeface;
+	}
+
+	/**
+	* Resolve several palette entries in one pass.
+	* @param Colors - the palette entries to resolve
+	* @param OutColors - receives the resolved colors, must be at least as large as Colors
+	*/
+	void GetPaletteColors(TConstArrayView<EPalette> Colors, TArrayView<FLinearColor> OutColors) const;
+
+	/**
+	* Rebuild the cached style data affected by the change (palette table, etc.) and broadcast OnStyleChanged.
+	* Used by the setters, and when the active style assets are edited in place.
+	* @param StyleChanges - the parts of the style that changed
+	*/
+	void BroadcastStyleChanged(EWSStyleChange StyleChanges = EWSStyleChange::All);
+
+	/**
+	* Get the current style generation, incremented every time the theme, icon set or typography changes.
+	* Lets callers cache values derived from the style assets and cheaply detect when they are stale.
+	* @return StyleGeneration
+	*/
+	uint32 GetStyleGeneration() const
+	{
+		return StyleGeneration;
+	}
+
+	/**
+	* Add a constructed widget to the registry of widgets restyled on style changes. Called by UWidgetStudioBase.
+	* @param Widget - the widget to register
+	*/
+	void RegisterStyledWidget(UWidgetStudioBase* Widget);
+
+	/**
+	* Remove a widget from the restyle registry. Called by UWidgetStudioBase.
+	* @param Widget - the widget to unregister
+	*/
+	void UnregisterStyledWidget(UWidgetStudioBase* Widget);
+
+	/**
+	* Queue a widget whose restyle was deferred while it was off screen or collapsed, now that it is visible again.
+	* @param Widget - the widget to restyle
+	*/
+	void QueueRestyle(UWidgetStudioBase* Widget);
+
+	/**
+	* Get the current restyle serial, incremented every time OnStyleChanged is broadcast.
+	* Widgets whose styling was last updated for an older serial are stale.
+	* @return RestyleSerial
+	*/
+	static FORCEINLINE uint32 GetRestyleSerial()
+	{
+		return RestyleSerial;
+	}
+
 	UFUNCTION(BlueprintPure, Category = "Widget Studio|Initialization")
 	bool IsPluginInitialized() const
 	{
@@ -202,6 +420,30 @@ private:
 	 */
 	void SaveValuesToIni() const;
 
+	/**
+	 * Broadcast OnStyleChanged and save the settings, or defer both to CommitStyleEdit if a style edit is open
+	 * @param StyleChanges - the parts of the style that changed
+	 */
+	void NotifyStyleChanged(EWSStyleChange StyleChanges);
+
+	/**
+	 * Save the current style settings -- to the default .ini file in the editor, otherwise to a per-user
+	 * settings file written from a background task
+	 */
+	void SaveStyleSettings() const;
+
+	/**
+	 * Get the per-user style settings file used outside of the editor
+	 * @return the file path
+	 */
+	static FString GetUserSettingsPath();
+
+	/** The latest background save of the style settings, waited on when the subsystem shuts down */
+	mutable TFuture<void> StyleSaveTask;
+
+	int32 StyleEditDepth = 0;
+	EWSStyleChange PendingStyleChanges = EWSStyleChange::None;
+
 	/**
 	* Keeps Theme, IconSet, Typography valid if data assets are renamed
 	* @param AssetData Asset data which includes the asset with the new name
@@ -211,6 +453,80 @@ private:
 	
 	void HandleAssetAdded(const FAssetData& AssetData);
 
+	/**
+	 * Make a loaded asset the active Theme / IconSet / Typography, persist it and broadcast OnStyleChanged
+	 */
+	void ApplyTheme(const TSoftObjectPtr<UWidgetStudioTheme>& InTheme, UWidgetStudioTheme* LoadedTheme);
+	void ApplyIconSet(const TSoftObjectPtr<UWidgetStudioIconSet>& InIconSet, UWidgetStudioIconSet* LoadedIconSet);
+	void ApplyTypography(const TSoftObjectPtr<UWidgetStudioTypography>& InTypography, UWidgetStudioTypography* LoadedTypography);
+
+	/**
+	 * Load a style asset through the streamable manager, calling OnLoaded right away if it is already resident
+	 * @param AssetPath - the asset to load
+	 * @param Priority - async loading priority
+	 * @param OnLoaded - called with the loaded asset, or nullptr if it could not be loaded
+	 */
+	void LoadStyleAssetAsync(const FSoftObjectPath& AssetPath, int32 Priority, TFunction<void(UObject*)>&& OnLoaded);
+
+	FStreamableManager StreamableManager;
+
+	TArray<TSharedPtr<FStreamableHandle>> PendingStyleLoads;
+
+	TSharedPtr<FStreamableHandle> PrefetchHandle;
+
+	uint32 PendingThemeRequest = 0;
+	uint32 PendingIconSetRequest = 0;
+	uint32 PendingTypographyRequest = 0;
+
+	/* Resolved style assets -- hard references so the getters never hit GConfig or the package system */
+
+	UPROPERTY(Transient)
+	UWidgetStudioTheme* ActiveTheme = nullptr;
+
+	UPROPERTY(Transient)
+	UWidgetStudioIconSet* ActiveIconSet = nullptr;
+
+	UPROPERTY(Transient)
+	UWidgetStudioTypography* ActiveTypography = nullptr;
+
+	uint32 StyleGeneration = 0;
+
+	/* Palette table indexed by EPalette, with one trailing white entry used as the fallback for invalid values */
+
+	static constexpr int32 PaletteFallbackIndex = static_cast<int32>(EPalette::Palette_Max);
+
+	TStaticArray<FLinearColor, PaletteFallbackIndex + 1> PaletteColors;
+
+	/**
+	 * Bake the active theme and the basic colors into PaletteColors
+	 */
+	void RebuildPaletteColors();
+
+	/* Font matrix indexed by EWSFontType and ESizeModifier, with a trailing unscaled column for invalid modifiers */
+
+	static constexpr int32 FontTypeCount = static_cast<int32>(EWSFontType::FontType_Max);
+
+	static constexpr int32 FontModifierCount = static_cast<int32>(ESizeModifier::SizeModifier_Max) + 1;
+
+	TStaticArray<FSlateFontInfo, FontTypeCount * FontModifierCount> FontInfos;
+
+	UPROPERTY(Transient)
+	UFont* ActiveTypeface = nullptr;
+
+	/**
+	 * Build the font info of every font type and size modifier from the active typography
+	 */
+	void RebuildFontInfos();
+
+	/* Icon table indexed by EIconItem, built from the UTexture2D properties of the active icon set */
+
+	TStaticArray<UTexture2D*, static_cast<int32>(EIconItem::IconItem_Max)> IconTextures;
+
+	/**
+	 * Resolve every EIconItem to the matching texture property of the active icon set
+	 */
+	void RebuildIconTextures();
+
 	bool bIsPluginInitialized = false;
 	bool bIsDataAssetRenameInProcess = false;
 
@@ -218,4 +534,46 @@ private:
 	FString ChangedDataAssetType = TEXT("");
 
 	static UWidgetStudioSubsystem *Instance;
+
+	static FWidgetStudioStyleConstants StyleConstants;
+
+	/**
+	 * Copy BorderRadius, IdealWidth and IdealHeight into the static StyleConstants
+	 */
+	void UpdateStyleConstants();
+
+	/* Widget registry and the time-sliced restyle queue */
+
+	TArray<TWeakObjectPtr<UWidgetStudioBase>> StyledWidgets;
+
+	TArray<TWeakObjectPtr<UWidgetStudioBase>> RestyleQueue;
+
+	int32 RestyleCursor = 0;
+
+	static uint32 RestyleSerial;
+
+#if ENGINE_MAJOR_VERSION == 4
+	FDelegateHandle RestyleTickerHandle;
+#else
+	FTSTicker::FDelegateHandle RestyleTickerHandle;
+#endif
+
+	/**
+	 * Queue every on-screen registered widget that depends on the changed style parts for a restyle, and start the
+	 * restyle ticker
+	 * @param StyleChanges - the parts of the style that changed
+	 */
+	void BeginRestyle(EWSStyleChange StyleChanges);
+
+	/**
+	 * Restyle queued widgets until the per-frame budget is spent
+	 * @param DeltaTime - time since the last tick
+	 * @return true while queued widgets remain
+	 */
+	bool TickRestyle(float DeltaTime);
+
+	/**
+	 * Start the restyle ticker if it is not already running
+	 */
+	void StartRestyleTicker();
 };
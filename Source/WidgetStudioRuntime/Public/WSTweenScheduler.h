@@ -0,0 +1,271 @@
+﻿/* 
+* Copyright (c) 2021 THEIA INTERACTIVE.  All rights reserved.
+*
+* Website: https://widgetstudio.design
+* Documentation: https://docs.widgetstudio.design
+* Support: marketplace@theia.io
+* Marketplace FAQ: https://marketplacehelp.epicgames.com
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Types/WSEnums.h"
+
+class UWidget;
+class UWidgetStudioBase;
+
+/** The widget properties the tween scheduler can animate */
+enum class EWSTweenProperty : uint8
+{
+	WidgetColor,			// UUserWidget color and opacity
+	ImageColor,				// UImage color and opacity
+	TextColor,				// UTextBlock color and opacity
+	EditableTextBoxColor,	// UEditableTextBox foreground color
+	SizeBoxOverrides,		// USizeBox width / height overrides
+	SizeBoxMinOverrides,	// USizeBox min desired width / height
+	RenderTranslation,
+	RenderScale,
+	RenderAngle,
+	RenderOpacity,
+	BrushImageSize,			// UImage brush image size
+
+	Property_Max
+};
+
+/**
+ * Drives every Widget Studio animation. Widgets set a target for a property and the scheduler advances only the
+ * properties that are still moving, on every step of the animation clock, dropping each tween as soon as it reaches its target. A widget with
+ * no active tweens costs nothing per frame.
+ */
+class WIDGETSTUDIORUNTIME_API FWidgetStudioTweenScheduler
+{
+
+public:
+
+	/** Create the scheduler */
+	static void Initialize();
+
+	/** Destroy the scheduler, leaving animated properties where they are */
+	static void Shutdown();
+
+	/**
+	* Get the scheduler instance
+	* @pre Initialize has been called by the runtime module
+	* @return the scheduler
+	*/
+	static FWidgetStudioTweenScheduler& Get();
+
+	/**
+	* Animate a property of a widget towards a target value. Retargets the running tween of the property if there is
+	* one, otherwise starts a tween unless the property is already within the settle epsilon of the target.
+	* Properties of Widget Studio widgets with an easing curve other than exponential follow that curve over the
+	* widget's animation duration, scaled by how much faster than its animation time the speed is.
+	* Properties the Widget Studio quality level does not animate are set right away.
+	* The Widget Studio widget owning the animated widget is notified when its first tween starts and its last one settles.
+	* @param Widget - the widget to animate
+	* @param Property - the property to animate
+	* @param TargetValue - the target, packed as (R, G, B, A), (X, Y) or (Value)
+	* @param Speed - the interpolation speed, 0 or less sets the target right away
+	*/
+	void AnimateTo(UWidget* Widget, EWSTweenProperty Property, const FVector4& TargetValue, float Speed);
+
+	/**
+	* Get the number of properties currently animating
+	* @return the number of active tweens
+	*/
+	int32 GetNumActiveTweens() const
+	{
+		return Tweens.Num();
+	}
+
+	/**
+	* Evaluate an easing curve from its lookup table
+	* @param Easing - the easing curve
+	* @param Time - the normalized time, from 0 to 1
+	* @return the eased value, 0 at the start and 1 at the end of the curve
+	*/
+	static float EvaluateEasing(EWSEasing Easing, float Time);
+
+	/** Counters of how often the per-frame animation budget was exceeded, for tuning WidgetStudio.AnimationBudget */
+	struct FBudgetStats
+	{
+		/* Frames with more active tweens than the budget */
+		uint32 FramesOverBudget = 0;
+
+		/* Tweens snapped to their target because they were over budget */
+		uint32 SnappedTweens = 0;
+
+		/* Tween updates skipped because they were over budget */
+		uint32 ThrottledTweens = 0;
+	};
+
+	/**
+	* Get the budget counters accumulated since the scheduler was created or the counters were last reset
+	* @return the budget counters
+	*/
+	const FBudgetStats& GetBudgetStats() const
+	{
+		return BudgetStats;
+	}
+
+	/** Reset the budget counters */
+	void ResetBudgetStats()
+	{
+		BudgetStats = FBudgetStats();
+	}
+
+	/**
+	* Read the current value of an animatable property
+	* @param Widget - the widget to read from, must match the property type
+	* @param Property - the property to read
+	* @return the value packed as in AnimateTo
+	*/
+	static FVector4 ReadProperty(const UWidget* Widget, EWSTweenProperty Property);
+
+	/**
+	* Write the value of an animatable property
+	* @param Widget - the widget to write to, must match the property type
+	* @param Property - the property to write
+	* @param Value - the value packed as in AnimateTo
+	*/
+	static void WriteProperty(UWidget* Widget, EWSTweenProperty Property, const FVector4& Value);
+
+	/**
+	* Get the distance from the target under which a property snaps to it -- half an 8-bit step for colors and opacity,
+	* a tenth of a pixel for sizes and translations
+	* @param Property - the property
+	* @return the settle epsilon, per channel
+	*/
+	static float GetSettleEpsilon(EWSTweenProperty Property);
+
+	/**
+	* Check whether a property is a color or opacity fade, rather than motion
+	* @param Property - the property
+	* @return true for color and opacity properties
+	*/
+	static bool IsFade(EWSTweenProperty Property);
+
+	~FWidgetStudioTweenScheduler();
+
+private:
+
+#if WITH_DEV_AUTOMATION_TESTS
+	friend class FWidgetStudioTweenKernelTest;
+	friend class FWidgetStudioTestRenderer;
+#endif
+
+	struct FTweenKey
+	{
+		const UWidget* Widget;
+		EWSTweenProperty Property;
+
+		bool operator==(const FTweenKey& Other) const
+		{
+			return Widget == Other.Widget && Property == Other.Property;
+		}
+
+		friend uint32 GetTypeHash(const FTweenKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.Widget), static_cast<uint32>(Key.Property));
+		}
+	};
+
+	struct FTweenInfo
+	{
+		/* The raw key the tween was added under, the weak widget pointer can't rebuild it once the widget is gone */
+		FTweenKey Key;
+		TWeakObjectPtr<UWidget> Widget;
+		TWeakObjectPtr<UWidgetStudioBase> Owner;
+		EWSEasing Easing;
+	};
+
+	FWidgetStudioTweenScheduler() = default;
+
+	/**
+	 * Advance every active tween and write the results back to the widgets, stopping to listen to the animation clock
+	 * once no tweens remain
+	 * @param DeltaTime - time since the last step of the animation clock
+	 */
+	void Tick(float DeltaTime);
+
+	/**
+	 * Snap or throttle the tweens beyond the per-frame budget. Tweens of widgets with animation priority are kept at
+	 * full rate first, then the remaining budget goes to the other tweens in order
+	 * @param Budget - the number of tweens advanced at full rate
+	 */
+	void ApplyBudget(int32 Budget);
+
+	/** Remove a tween, moving the last tween into its slot */
+	void RemoveTween(int32 Index);
+
+	/** Broadcast OnAnimationSettled for owners whose last tween was removed */
+	void BroadcastSettledOwners();
+
+	/**
+	 * Advance tweens by blending from their start value to their target. Exponential tweens snap the channels within
+	 * epsilon of their target and move their start value along, timed tweens keep it.
+	 * @param Current - current values, 4 per tween, 16 byte aligned
+	 * @param Start - start values, 4 per tween, 16 byte aligned
+	 * @param Target - target values, 4 per tween, 16 byte aligned
+	 * @param Weights - blend weight per tween
+	 * @param Epsilons - settle epsilon per tween
+	 * @param Durations - duration per tween, 0 for exponential tweens
+	 * @param NumTweens - the number of tweens
+	 */
+	static void AdvanceTweens(float* RESTRICT Current, float* RESTRICT Start, const float* RESTRICT Target, const float* RESTRICT Weights,
+		const float* RESTRICT Epsilons, const float* RESTRICT Durations, int32 NumTweens);
+
+	/** Sample every easing curve into its lookup table */
+	static void BuildEasingTables();
+
+	/*
+	 * Tween state in structure-of-arrays form, so the whole set is advanced in one SIMD pass.
+	 * Each tween owns 4 consecutive floats in CurrentValues and TargetValues, and one entry in the other arrays.
+	 */
+
+	TArray<FTweenInfo> Tweens;
+
+	TArray<float, TAlignedHeapAllocator<16>> CurrentValues;
+
+	TArray<float, TAlignedHeapAllocator<16>> StartValues;
+
+	TArray<float, TAlignedHeapAllocator<16>> TargetValues;
+
+	TArray<float> Speeds;
+
+	TArray<float> Epsilons;
+
+	/* Duration of timed tweens, 0 for exponential ones */
+	TArray<float> Durations;
+
+	TArray<float> Elapsed;
+
+	int32 NumTimedTweens = 0;
+
+	/* Scratch arrays for the per-tween step time and blend weight of the current tick */
+	TArray<float> StepTimes;
+
+	TArray<float> Weights;
+
+	TArray<TWeakObjectPtr<UWidgetStudioBase>> SettledOwners;
+
+	/* Scratch array flagging the tweens kept at full rate while over budget */
+	TBitArray<> FullRateTweens;
+
+	FBudgetStats BudgetStats;
+
+	/* Ticks since the scheduler was created, spreads throttled tweens over frames */
+	uint32 TickCount = 0;
+
+	TMap<FTweenKey, int32> TweenIndices;
+
+	FDelegateHandle ClockHandle;
+
+	static constexpr int32 EasingTableSize = 256;
+
+	static float EasingTables[static_cast<int32>(EWSEasing::Easing_Max)][EasingTableSize + 1];
+
+	static TUniquePtr<FWidgetStudioTweenScheduler> Instance;
+};
@@ -56,10 +56,14 @@ class WIDGETSTUDIORUNTIME_API UWidgetStudioIcon : public UWidgetStudioBase
 protected:
 	
 	virtual TSharedRef<SWidget> RebuildWidget() override;
-	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual void UpdateAnimationTargets() override;
 	virtual void SynchronizeProperties() override;
 	virtual void InitializeStyling() override;
 	virtual void UpdateStyling() override;
+	virtual EWSStyleChange GetStyleDependencies() const override
+	{
+		return EWSStyleChange::Palette | EWSStyleChange::IconSet;
+	}
 
 	// Widget Components
 
@@ -106,6 +106,14 @@ struct FButtonOptions
 	*/
 	UPROPERTY(EditAnywhere, Category = "Widget Studio")
 	bool bIsCheckedStateLocked;
+
+	/**
+	 * Optional stable identifier of the option.
+	 * When every option has a unique key, containers match options by key when the options are replaced, so reordered
+	 * options keep their buttons and the selection follows the selected option.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Widget Studio", AdvancedDisplay)
+	FName Key;
 	
 	explicit FButtonOptions(
 		const EButtonContentStyle InContentStyle = EButtonContentStyle::Label,
@@ -121,6 +129,18 @@ struct FButtonOptions
 		Icon = InIcon;
 		CustomIcon = InCustomIcon;
 	}
+
+	/** Returns true if both options display the same content. */
+	bool IsIdentical(const FButtonOptions& Other) const
+	{
+		return Key == Other.Key
+			&& ContentStyle == Other.ContentStyle
+			&& Icon == Other.Icon
+			&& CustomIcon == Other.CustomIcon
+			&& bIsCheckedStateLocked == Other.bIsCheckedStateLocked
+			&& (Text.IdenticalTo(Other.Text) || Text.ToString().Equals(Other.Text.ToString(), ESearchCase::CaseSensitive))
+			&& (ToolTip.IdenticalTo(Other.ToolTip) || ToolTip.ToString().Equals(Other.ToolTip.ToString(), ESearchCase::CaseSensitive));
+	}
 };
 
 /**
@@ -134,7 +154,7 @@ class WIDGETSTUDIORUNTIME_API UWidgetStudioModernButton : public UWidgetStudioBu
 protected:
 	
 	virtual TSharedRef<SWidget> RebuildWidget() override;
-	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual void UpdateAnimationTargets() override;
 	virtual void SynchronizeProperties() override;
 	virtual void InitializeStyling() override;
 	virtual void UpdateStyling() override;
@@ -30,10 +30,12 @@ class WIDGETSTUDIORUNTIME_API UWidgetStudioModernComboBox : public UWidgetStudio
 protected:
 	
 	virtual TSharedRef<SWidget> RebuildWidget() override;
-	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual void UpdateAnimationTargets() override;
 	virtual void SynchronizeProperties() override;
 	virtual void InitializeStyling() override;
 	virtual void UpdateStyling() override;
+	virtual void ConstructOption(const FButtonOptions& Option) override;
+	virtual void OnOptionsChanged() override;
 	
 	virtual FReply NativeOnMouseButtonDown(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 
@@ -41,7 +43,16 @@ protected:
 	void OnMenuButtonSelected(int32 Index, FButtonOptions Option);
 
 	UFUNCTION()
-	UUserWidget* ConstructMenu() const;
+	void OnMenuOpenChanged(bool bIsOpen);
+
+	UFUNCTION()
+	UUserWidget* ConstructMenu();
+
+	/** Returns true if the menu was styled with properties that have changed since. */
+	bool IsMenuStyleOutdated() const;
+
+	/** Apply the styling of the Combo Box to the menu. */
+	void ApplyMenuStyling();
 
 	/* * Widget Components */
 
@@ -87,6 +98,13 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Widgets")
 	UMenuAnchor* MenuAnchor = nullptr;
 
+	/** The dropdown menu. It is built on the first open and kept for the following ones. */
+	UPROPERTY(Transient)
+	UWidgetStudioModernTabBar* Menu = nullptr;
+
+	/** True when the options have changed since they were handed to the menu. */
+	bool bAreMenuOptionsOutdated = true;
+
 private:
 
 	// General Properties
@@ -155,6 +173,13 @@ private:
 	/** The maximum height of the dropdown menu. If the number of options exceeds this height, the menu will become scrollable. */
 	UPROPERTY(EditAnywhere, Category = "Widget Studio|Style")
 	float MenuHeight = 225;
+
+	/**
+	 * Only create buttons for the options in view of the dropdown menu, recycling them while scrolling.
+	 * Keeps opening the menu fast with thousands of options.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Widget Studio|Style")
+	bool bVirtualizeMenu = false;
 	
 	// State Properties
 	
@@ -167,6 +192,7 @@ private:
 public:
 	// Overrides
 	virtual void SetCurrentIndex(int32 Index, bool bBroadcast) override;
+	virtual void ClearOptions() override;
 
 	// Helpers
 
@@ -202,6 +228,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Widget Studio|Helper|Color")
 	bool IsSelectable() const;
 
+	/** Returns if the dropdown menu only creates buttons for the options in view. */
+	UFUNCTION(BlueprintPure, Category = "Widget Studio|Helper")
+	bool IsMenuVirtualized() const;
+
 	
 	// Modifiers
 
@@ -261,5 +291,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Modifier")
 	void SetSelectable(bool NewState);
 
+	/**
+	 * Only create buttons for the options in view of the dropdown menu, recycling them while scrolling.
+	 * Takes effect the next time the menu opens.
+	 * @param NewState Enable to virtualize the menu.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Modifier")
+	void SetVirtualizeMenu(bool NewState);
+
 };
 
@@ -29,7 +29,7 @@ class WIDGETSTUDIORUNTIME_API UWidgetStudioModernSpinBox : public UWidgetStudioS
 protected:
 	
 	virtual TSharedRef<SWidget> RebuildWidget() override;
-	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual void UpdateAnimationTargets() override;
 	virtual FReply NativeOnMouseButtonDown(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 	virtual FReply NativeOnMouseWheel(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 	virtual void SynchronizeProperties() override;
@@ -160,6 +160,8 @@ public:
 	/** Returns true if the user can interface with the Spin Box via dragging. */
 	UFUNCTION(BlueprintPure, Category="Widget Studio|Helper")
 	bool IsDragInputEnabled() const;
+
+	virtual bool HasAnimationPriority() const override;
 	
 	/** Returns the background color. */
 	UFUNCTION(BlueprintPure, Category="Widget Studio|Helper")
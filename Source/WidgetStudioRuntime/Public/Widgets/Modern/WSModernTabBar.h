@@ -40,14 +40,106 @@ class WIDGETSTUDIORUNTIME_API UWidgetStudioModernTabBar : public UWidgetStudioCo
 protected:
 	
 	virtual TSharedRef<SWidget> RebuildWidget() override;
-	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual void UpdateAnimationTargets() override;
 	virtual void SynchronizeProperties() override;
 	virtual void InitializeStyling() override;
 	virtual void UpdateStyling() override;
-	virtual void ConstructOption(FButtonOptions Option) override;
+	virtual void ConstructOption(const FButtonOptions& Option) override;
 	virtual void ClearOptions() override;
+	virtual void OnOptionsChanging() override;
+	virtual void OnOptionInserted(int32 Index) override;
+	virtual void OnOptionRemoved(int32 Index) override;
+	virtual void OnOptionMoved(int32 FromIndex, int32 ToIndex) override;
+	virtual void OnOptionUpdated(int32 Index) override;
+	virtual void OnOptionsChanged() override;
 	virtual void ConstructButtonGroup();
 
+	/**
+	 * Get the pooled button of an option, creating buttons only when the options outgrow the pool
+	 * @param Index The index of the option.
+	 */
+	UWidgetStudioModernButton* AcquireButton(int32 Index);
+
+	/** Create a button for the pool, bound to the tab bar. */
+	UWidgetStudioModernButton* CreateButton();
+
+	/**
+	 * Note an option whose button or grid cell changed while Set Options runs.
+	 * @param Index The index of the option.
+	 */
+	void MarkButtonChanged(int32 Index);
+
+	/** Hand buttons to the inserted options and park the buttons left over, once Set Options has diffed the options. */
+	void FinishButtonDiff();
+
+	/**
+	 * Place a pooled button in the grid cell of its option.
+	 * @param Button The pooled button.
+	 * @param Index The index of the option.
+	 */
+	void ActivateButton(UWidgetStudioModernButton* Button, int32 Index);
+
+	/**
+	 * Style a pooled button in place for an option.
+	 * @param Button The pooled button.
+	 * @param Option The option to display.
+	 * @param Index The index of the option.
+	 */
+	void ApplyOption(UWidgetStudioModernButton* Button, const FButtonOptions& Option, int32 Index);
+
+	/**
+	 * Move the pooled buttons in a range of options to the grid cells of their options.
+	 * @param FirstIndex The index of the first option.
+	 * @param LastIndex The index of the last option.
+	 */
+	void UpdateButtonCells(int32 FirstIndex, int32 LastIndex);
+
+	/**
+	 * Take the pooled buttons from an index onwards out of the grid, keeping them for reuse.
+	 * @param FirstIndex The index of the first button to park.
+	 */
+	void ParkButtons(int32 FirstIndex);
+
+	/**
+	 * Take a pooled button out of the grid, keeping it for reuse.
+	 * @param Button The pooled button.
+	 */
+	void ParkButton(UWidgetStudioModernButton* Button);
+
+	/** Hand the buttons of the options to the Button Group in option order. */
+	void RegisterButtons();
+
+	/** Returns true if only the options in view have buttons. */
+	bool IsVirtualizing() const;
+
+	/**
+	 * Returns the index of an option's button in the Button Group, or -1 if the option has no button.
+	 * @param Index The index of the option.
+	 */
+	int32 GetButtonIndex(int32 Index) const;
+
+	/**
+	 * Returns the button showing an option, or nullptr if the option has no button.
+	 * @param Index The index of the option.
+	 */
+	UWidgetStudioModernButton* GetOptionButton(int32 Index) const;
+
+	/** Returns the padding the grid puts around every button. */
+	FMargin GetGridSlotPadding() const;
+
+	/** Returns the height of an option row, measured from the laid out buttons once there are any. */
+	float MeasureRowHeight() const;
+
+	/**
+	 * Give buttons to the options in view, recycling the buttons of the options that scrolled out of view.
+	 * @param bForce Restyle every button in view, rather than only the ones that were recycled.
+	 */
+	void RealizeOptionsInView(bool bForce);
+
+	UFUNCTION()
+	void OnScrolled(float CurrentOffset);
+
 	UFUNCTION()
 	void UpdateIndexFromButtonGroup(int32 NewIndex);
 	
@@ -90,6 +182,32 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Widgets")
 	UUniformGridPanel* Grid = nullptr;
 
+	/* The option buttons in option order. Buttons past the option count are parked out of the grid until reused. */
+	UPROPERTY(Transient)
+	TArray<UWidgetStudioModernButton*> ButtonPool;
+
+	/** The index of the option shown by the first button while virtualizing. */
+	int32 FirstRealizedIndex = 0;
+
+	/** The number of options that have a button while virtualizing. */
+	int32 NumRealized = 0;
+
+	/** How far down the grid is pushed to line the buttons up with their options while virtualizing. */
+	float RealizedOffset = 0.f;
+
+	/** The row height the options in view were realized with while virtualizing. */
+	float RealizedRowHeight = 0.f;
+
+	/** True while Set Options diffs the options and the buttons follow them. */
+	bool bIsDiffingButtons = false;
+
+	/** The buttons as they were before Set Options, so the diff callbacks can find them by their previous index. */
+	TArray<UWidgetStudioModernButton*> PreviousButtons;
+
+	/** The range of options whose button or grid cell changed while Set Options runs. */
+	int32 FirstChangedButton = 0;
+	int32 LastChangedButton = -1;
+
 	// Properties
 
 	
@@ -152,6 +270,13 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Widget Studio|Scrolling", Meta = (EditCondition="bEnableScrolling", EditConditionHides))
 	ESlateVisibility ScrollBarVisibility = ESlateVisibility::Visible;
 
+	/**
+	 * Only create buttons for the options in view, recycling them while scrolling. Useful for long lists of options.
+	 * Requires a vertical Tab Bar with a Size Constraint, and options that are all the same height.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Widget Studio|Scrolling", Meta = (EditCondition="bEnableScrolling", EditConditionHides))
+	bool bVirtualizeOptions = false;
+
 	// Style Properties
 
 	/** Enables the drop shadow effect when hovered. */
@@ -189,6 +314,8 @@ protected:
 	bool bSelectable = true;
 
 public:
+	// Overrides
+	virtual void SetOptionsSource(const UWidgetStudioContainer* Source) override;
 
 	// Helpers
 
@@ -251,6 +378,10 @@ public:
 	UFUNCTION(BlueprintGetter, Category="Widget Studio|Helper")
 	ESlateVisibility GetScrollbarVisibility() const;
 
+	/** Returns if only the options in view have buttons. */
+	UFUNCTION(BlueprintGetter, Category="Widget Studio|Helper")
+	bool IsVirtualized() const;
+
 	// Modifiers
 	
 	/**
@@ -302,6 +433,13 @@ public:
 	UFUNCTION(BlueprintSetter, Category = "Widget Studio|Modifier")
 	void SetSelectable(bool NewState);
 
+	/**
+	 * Restyle the Tab Bar and its buttons for its current properties.
+	 * Use after setters that only store their property, like the color setters.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Modifier")
+	void RestyleButtons();
+
 
 	// Scrolling Modifiers
 
@@ -328,6 +466,14 @@ public:
 	UFUNCTION(BlueprintSetter, Category = "Widget Studio|Modifier")
 	void SetScrollbarVisibility(ESlateVisibility NewVisibility);
 
+	/**
+	 * Only create buttons for the options in view, recycling them while scrolling.
+	 * Requires a vertical Tab Bar with a Size Constraint, and options that are all the same height.
+	 * @param NewState Enable to virtualize the options.
+	 */
+	UFUNCTION(BlueprintSetter, Category = "Widget Studio|Modifier")
+	void SetVirtualized(bool NewState);
+
 	/**
 	 * Set the alignment of the content.
 	 * @param NewAlignment The new alignment to apply to the content.
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ScrollBox.h"
+#include "Types/WSEnums.h"
 #include "WSScrollBox.generated.h"
 
 /**
@@ -15,9 +16,13 @@ class WIDGETSTUDIORUNTIME_API UWSScrollBox : public UScrollBox
 	GENERATED_BODY()
 	virtual TSharedRef<SWidget> RebuildWidget() override;
 
+	/** Stop listening to the Widget Studio theme, also called when the scroll box is destroyed */
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
 	/** Update the scroll bar styling when the Widget Studio theme changes */
-	UFUNCTION()
-	void OnStyleChanged();
+	void OnStyleChanged(EWSStyleChange StyleChanges);
+
+	FDelegateHandle StyleChangedHandle;
 
 protected:
 	
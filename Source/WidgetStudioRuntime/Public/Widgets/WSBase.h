@@ -22,6 +22,7 @@
 class UWidgetStudioBase;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FWSBaseHoverStateDelegate, UWidgetStudioBase*, CallingWidget, bool, bIsHovering);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FWSBaseAnimationStateDelegate, UWidgetStudioBase*, CallingWidget);
 
 /**
  * The base User Widget class for Widget Studio.
@@ -50,19 +51,44 @@ protected:
 	 */
 	virtual void UpdateStyling();
 
+	/*
+	 * Sets the animation targets of the widget for its current state, through the Interp functions of the Widget Studio Function Library.
+	 * - This function should be overriden in a child widget.
+	 * - Called on tick after MarkAnimationTargetsDirty(), so that painting never changes the state of the widget and
+	 *   settled widgets don't update their targets every frame.
+	 */
+	virtual void UpdateAnimationTargets();
+
+	/* Registers the widget with the Widget Studio Subsystem, so it is restyled when the style changes */
+	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
 	/* Used for event passthroughs */
 	virtual void NativeOnMouseEnter(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
 	virtual void NativeOnMouseLeave(const FPointerEvent& InMouseEvent) override;
 	virtual void NativeOnMouseCaptureLost(const FCaptureLostEvent& CaptureLostEvent) override;
+	virtual void NativeOnAddedToFocusPath(const FFocusEvent& InFocusEvent) override;
+	virtual void NativeOnRemovedFromFocusPath(const FFocusEvent& InFocusEvent) override;
 
 public:
 
+	virtual void SynchronizeProperties() override;
+
 	// Bindings
 	
 	/** Called when the hover state has been changed. */
 	UPROPERTY(BlueprintAssignable, Category = "Widget Studio|Event")
 	FWSBaseHoverStateDelegate OnHoverStateChanged;
 
+	/** Called when the widget starts animating, after having been settled. */
+	UPROPERTY(BlueprintAssignable, Category = "Widget Studio|Event")
+	FWSBaseAnimationStateDelegate OnAnimationStarted;
+
+	/** Called when every animation of the widget has reached its target. */
+	UPROPERTY(BlueprintAssignable, Category = "Widget Studio|Event")
+	FWSBaseAnimationStateDelegate OnAnimationSettled;
+
 	// Properties
 
 	/**
@@ -85,7 +111,7 @@ public:
 	
 	/**
 	* Used for debugging.
-	* Disables the OnPaint event in many of the widgets, thus disabling all animations and smooth transitions. May cause graphical inconsistencies.
+	* Disables the animation updates in many of the widgets, thus disabling all animations and smooth transitions. May cause graphical inconsistencies.
 	*/
 	UPROPERTY(EditAnywhere, Category = "Developer")
 	bool bDisablePainting = false;
@@ -98,6 +124,29 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Widget Studio", AdvancedDisplay)
 	float AnimationTime = 7;
 
+	/**
+	 * The curve animations follow.
+	 * - Exponential approaches the target at the Animation Time speed and never lands in a set time.
+	 * - The other curves ease out over the Animation Duration and land on their target exactly at its end.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Widget Studio", AdvancedDisplay)
+	EWSEasing Easing = EWSEasing::Exponential;
+
+	/**
+	 * The duration in seconds of animations following an easing curve.
+	 * Animations the widget plays faster or slower than its Animation Time are shortened or lengthened to match.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Widget Studio", AdvancedDisplay, Meta = (ClampMin = "0", UIMin = "0", EditCondition = "Easing != EWSEasing::Exponential"))
+	float AnimationDuration = 0.25f;
+
+	/**
+	 * Animate size changes with a render transform scale instead of resizing the layout every frame.
+	 * The layout is resized once, and only paint is invalidated while the widget animates.
+	 * Enabled only on select visual widgets.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Widget Studio", AdvancedDisplay)
+	bool bAnimateWithRenderTransform = false;
+
 	/**
 	* Quickly modify the overall size of the widget.
 	* - Mini: 55%
@@ -155,4 +204,71 @@ public:
 	/** Set the size modifier of the Widget Studio widget. */
 	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Advanced")
 	void SetSizeModifier(ESizeModifier InSizeModifier);
+
+	/**
+	 * Refresh the animation targets on the next tick. Call after changing any state the animation targets are derived
+	 * from that doesn't go through SynchronizeProperties() or UpdateStyling().
+	 */
+	void MarkAnimationTargetsDirty()
+	{
+		AnimationTargetTicks = 2;
+	}
+
+	/**
+	 * Returns true if the widget was ticked this frame or the last one. Widgets are only ticked while they are painted,
+	 * so collapsed and culled widgets are not on screen.
+	 */
+	bool IsOnScreen() const
+	{
+		return LastTickFrame + 1 >= GFrameCounter;
+	}
+
+	/** Returns true while any animation of the widget is still moving. */
+	UFUNCTION(BlueprintPure, Category = "Widget Studio")
+	bool IsAnimating() const
+	{
+		return ActiveTweenCount > 0;
+	}
+
+	/**
+	 * Returns true if the user is interacting with the widget -- hovered, focused or pressed. Its animations keep
+	 * their full rate when the animation budget is exceeded.
+	 */
+	virtual bool HasAnimationPriority() const;
+
+	/**
+	 * Returns the parts of the style the widget's styling reads. Changes to other parts of the style don't restyle
+	 * the widget.
+	 */
+	virtual EWSStyleChange GetStyleDependencies() const
+	{
+		return EWSStyleChange::All;
+	}
+
+private:
+	friend class UWidgetStudioSubsystem;
+	friend class FWidgetStudioTweenScheduler;
+
+	/* The number of tweens running on this widget or its children */
+	int32 ActiveTweenCount = 0;
+
+	/* Index in the subsystem's widget registry */
+	int32 StyleRegistryIndex = INDEX_NONE;
+
+	/* The restyle serial the styling was last updated for */
+	uint32 AppliedRestyleSerial = 0;
+
+	/* True while waiting in the subsystem's restyle queue */
+	bool bRestyleQueued = false;
+
+	uint64 LastTickFrame = 0;
+
+	/*
+	 * Ticks left that refresh the animation targets. Marking the targets dirty refreshes them on two ticks, so targets
+	 * read from the paint geometry catch up with the layout of the change.
+	 */
+	uint8 AnimationTargetTicks = 2;
+
+	/* The local size of the widget on its last tick, targets read from the geometry move when it changes */
+	FVector2D LastTickSize = FVector2D::ZeroVector;
 };
@@ -133,6 +133,8 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Widget Studio|Helper|State")
 	bool IsPressed() const;
 
+	virtual bool HasAnimationPriority() const override;
+
 	/* Modifiers */
 
 	/**
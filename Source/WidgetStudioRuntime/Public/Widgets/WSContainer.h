@@ -27,12 +27,59 @@ class WIDGETSTUDIORUNTIME_API UWidgetStudioContainer : public UWidgetStudioBase
 	GENERATED_BODY()
 
 protected:
-	virtual void ConstructOption(FButtonOptions Option);
+	virtual void ConstructOption(const FButtonOptions& Option);
 	virtual void SynchronizeProperties() override;
 
 	UFUNCTION()
 	virtual void IndividualHoverStateChanged(UWidgetStudioBase* CallingWidget, const bool bIsHovering);
 
+	/**
+	 * Called by Set Options before the options are diffed. The indices passed to the callbacks below don't shift as
+	 * options come and go: removed options are given by their index in the previous options, the others by their
+	 * index in the new options.
+	 */
+	virtual void OnOptionsChanging();
+
+	/**
+	 * Called by Set Options for each option whose key is gone, from the last to the first.
+	 * @param Index The index the removed option was at in the previous options.
+	 */
+	virtual void OnOptionRemoved(int32 Index);
+
+	/**
+	 * Called by Set Options after an option has been inserted.
+	 * @param Index The index of the inserted option.
+	 */
+	virtual void OnOptionInserted(int32 Index);
+
+	/**
+	 * Called by Set Options for each kept option that ended up at another index.
+	 * @param FromIndex The index the option was at in the previous options.
+	 * @param ToIndex The index the option is at now.
+	 */
+	virtual void OnOptionMoved(int32 FromIndex, int32 ToIndex);
+
+	/**
+	 * Called by Set Options after the content of a kept option has changed, once it has been moved.
+	 * @param Index The index of the updated option.
+	 */
+	virtual void OnOptionUpdated(int32 Index);
+
+	/** Called once Set Options has applied every change and the current index has followed the selected option. */
+	virtual void OnOptionsChanged();
+
+	/** Diff the new options against the current ones by position, moving the changed options out of NewOptions. */
+	void ReconcileOptionsByPosition(TArray<FButtonOptions>&& NewOptions);
+
+	/**
+	 * Diff the new options against the current ones by key, moving the changed options out of NewOptions.
+	 * Every option must have a unique key.
+	 */
+	void ReconcileOptionsByKey(TArray<FButtonOptions>&& NewOptions);
+
+	/** Stop reading the options from the options source, keeping a copy of them as this container's own options. */
+	void ReleaseOptionsSource();
+
 	// Properties
 
 	/** The current option selected. A value of -1 will indicate that no option is selected. */
@@ -43,6 +90,9 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Widget Studio", Meta = (TitleProperty = "Text"))
 	TArray<FButtonOptions> Options;
 
+	/** The container the options are read from instead of Options, if any. */
+	TWeakObjectPtr<const UWidgetStudioContainer> OptionsSource;
+
 public:
 	// Bindings
 	
@@ -68,6 +118,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Widget Studio|Helper")
 	TArray<FButtonOptions> GetOptions() const;
 
+	/**
+	 * Returns a view of the options without copying them, read from the options source if there is one.
+	 * The view is invalidated when the options change.
+	 */
+	TConstArrayView<FButtonOptions> GetOptionsView() const;
+
 	/**Return the option at the given index. */
 	UFUNCTION(BlueprintPure, Category = "Widget Studio|Helper")
 	FButtonOptions GetOptionAtIndex(int32 Index);
@@ -111,11 +167,24 @@ public:
 
 	/**
 	 * Override the options in this container.
+	 * Only the options that changed are rebuilt. When every option has a unique key, options are matched by key, so
+	 * reordered options are moved rather than rebuilt and the current index follows the selected option.
+	 * OnCurrentIndexChanged is broadcast when the current index or the content of the selected option changed.
+	 * Pass the array with MoveTemp from C++ to hand the options over without copying them.
 	 * @param NewOptions The array of button options to use in the container.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Widget Studio|Modifier")
 	virtual void SetOptions(TArray<FButtonOptions> NewOptions);
 
+	/**
+	 * Read the options from another container instead of owning a copy of them, for containers that only show some of
+	 * the options at a time. Call again when the options of the source change. Set Options and Add Option go back to
+	 * owning a copy, Clear Options goes back to owning none.
+	 * A source that reads its options from this container, directly or through others, is rejected.
+	 * @param Source The container to read the options from, or nullptr to own a copy of the options again.
+	 */
+	virtual void SetOptionsSource(const UWidgetStudioContainer* Source);
+
 	/** Set the current index.
 	 * @param Index The index to set the current index to.
 	 * @param bBroadcast When true, OnCurrentIndexChanged will be broadcasted.